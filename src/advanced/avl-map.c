@@ -158,3 +158,18 @@ Bool AvlMapAll(AvlMap *const restrict map, TestFunction *const test) {
 
     return AvlTreeAll(map->tree, test);
 }
+
+Bool AvlMapSomeBatch(AvlMap *const restrict map,
+                     BatchTestFunction *const test) {
+    assert(map != NULL);
+    assert(test != NULL);
+
+    return AvlTreeSomeBatch(map->tree, test);
+}
+
+Bool AvlMapAllBatch(AvlMap *const restrict map, BatchTestFunction *const test) {
+    assert(map != NULL);
+    assert(test != NULL);
+
+    return AvlTreeAllBatch(map->tree, test);
+}
@@ -61,7 +61,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } AvlMap;
 
 /**
@@ -195,4 +195,28 @@ Bool AvlMapSome(AvlMap *const restrict map, TestFunction *const test);
  */
 Bool AvlMapAll(AvlMap *const restrict map, TestFunction *const test);
 
+/**
+ * @brief Pairs in `map` will be passed into `test()` as contiguous
+ * `AvlMapPair` runs of up to 64 pairs. If any bit is returned set, `TRUE` will
+ * be returned immediately. Otherwise, `FALSE` will be returned. O(n).
+ *
+ * @param map `this`.
+ * @param test Function used in checking which pairs satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool AvlMapSomeBatch(AvlMap *const restrict map, BatchTestFunction *const test);
+
+/**
+ * @brief Pairs in `map` will be passed into `test()` as contiguous
+ * `AvlMapPair` runs of up to 64 pairs. If any bit is returned clear, `FALSE`
+ * will be returned immediately. Otherwise, `TRUE` will be returned. O(n).
+ *
+ * @param map `this`.
+ * @param test Function used in checking which pairs satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool AvlMapAllBatch(AvlMap *const restrict map, BatchTestFunction *const test);
+
 #endif  // __COLLECTIONS_AVL_MAP__
@@ -64,7 +64,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } LinkedHeap;
 
 /**
@@ -3,83 +3,129 @@
 #include <assert.h>
 #include <malloc.h>
 #include <memory.h>
+#include <stdint.h>
 
-void PriorityQueueNodeConstruct(PriorityQueueNode *const restrict node,
-                                const int priority,
-                                const void *const restrict value,
-                                unsigned long elementSize) {
-    assert(node != NULL);
-    assert(value != NULL);
-    assert(elementSize > 0);
-
-    node->value = malloc(elementSize);
-    assert(node->value != NULL);
-    memcpy(node->value, value, elementSize);
-    node->priority = priority;
-}
-
-PriorityQueueNode *PriorityQueueNodeNew(const int priority,
-                                        const void *const restrict value,
-                                        unsigned long elementSize) {
-    PriorityQueueNode *node =
-        (PriorityQueueNode *)malloc(sizeof(PriorityQueueNode));
-    PriorityQueueNodeConstruct(node, priority, value, elementSize);
-    return node;
-}
-
-void PriorityQueueNodeDestruct(PriorityQueueNode *const restrict node) {
-    if (node == NULL) return;
+#include "batch-test.h"
 
-    free(node->value);
-    node->value = NULL;
-    node->priority = 0;
+/**
+ * @brief Get node at specified `index`. O(1).
+ *
+ * @param queue `this`.
+ * @param index Specified index.
+ * @return PriorityQueueNode* Node.
+ */
+static inline PriorityQueueNode *__node(const PriorityQueue *const queue,
+                                        const size_t index) {
+    return (PriorityQueueNode *)(queue->array + index * queue->nodeSize);
 }
 
-void PriorityQueueNodeDelete(PriorityQueueNode **const restrict node) {
-    if (node == NULL) return;
-
-    PriorityQueueNodeDestruct(*node);
-    free(*node);
-    *node = NULL;
+/**
+ * @brief Check if an element with priority `a` and sequence number `m` should
+ * be in front of an element with priority `b` and sequence number `n`. O(1).
+ *
+ * @param queue `this`.
+ * @param a Priority of the former.
+ * @param m Sequence number of the former.
+ * @param b Priority of the latter.
+ * @param n Sequence number of the latter.
+ * @return Bool
+ */
+static inline Bool __before(const PriorityQueue *const queue,
+                            const PriorityQueuePriority a,
+                            const unsigned long long m,
+                            const PriorityQueuePriority b,
+                            const unsigned long long n) {
+    switch (queue->type) {
+        case PRIORITY_QUEUE_INT64:
+            if (a.Int64 != b.Int64) return a.Int64 > b.Int64;
+            break;
+        case PRIORITY_QUEUE_UINT64:
+            if (a.UInt64 != b.UInt64) return a.UInt64 > b.UInt64;
+            break;
+        case PRIORITY_QUEUE_DOUBLE:
+            if (a.Double != b.Double) return a.Double > b.Double;
+            break;
+    }
+    return m < n;
 }
 
-static inline int __compare(const void *a, const void *b) {
-    const PriorityQueueNode *c = (PriorityQueueNode *)a,
-                            *d = (PriorityQueueNode *)b;
-    return c->priority - d->priority;
+/**
+ * @brief Move the empty top of `queue` down to where an element with
+ * `priority` and `sequence` belongs. O(log₂n).
+ *
+ * @param queue `this`.
+ * @param priority Priority of the element.
+ * @param sequence Sequence number of the element.
+ * @return PriorityQueueNode* The empty node.
+ */
+static PriorityQueueNode *__PriorityQueueSiftDown(
+    PriorityQueue *const restrict queue, const PriorityQueuePriority priority,
+    const unsigned long long sequence) {
+    PriorityQueueNode *child = NULL, *sibling = NULL;
+    size_t current = 0, next = 0;
+    while ((next = current * 2 + 1) < queue->Size) {
+        child = __node(queue, next);
+        if (next + 1 < queue->Size) {
+            sibling = __node(queue, next + 1);
+            if (__before(queue, sibling->priority, sibling->sequence,
+                         child->priority, child->sequence)) {
+                next++;
+                child = sibling;
+            }
+        }
+        if (!__before(queue, child->priority, child->sequence, priority,
+                      sequence))
+            break;
+        memcpy(__node(queue, current), child, queue->nodeSize);
+        current = next;
+    }
+    return __node(queue, current);
 }
 
 void PriorityQueueConstruct(PriorityQueue *const restrict queue,
-                            const unsigned int initialCapacity,
-                            const unsigned long elementSize) {
+                            const size_t initialCapacity,
+                            const unsigned long elementSize,
+                            const PriorityQueueType type, const Bool stable) {
     assert(queue != NULL);
     assert(initialCapacity > 0);
     assert(elementSize > 0);
 
-    queue->heap =
-        ArrayHeapNew(initialCapacity, sizeof(PriorityQueueNode), __compare);
+    // Keep every node header aligned. Any value whose alignment is larger than
+    // the header has a size which is a multiple of that alignment, so it is
+    // aligned as well.
+    queue->nodeSize = sizeof(PriorityQueueNode) + elementSize;
+    queue->nodeSize += (_Alignof(PriorityQueueNode) -
+                        queue->nodeSize % _Alignof(PriorityQueueNode)) %
+                       _Alignof(PriorityQueueNode);
+    queue->array = malloc(initialCapacity * queue->nodeSize);
+    assert(queue->array != NULL);
     queue->elementSize = elementSize;
+    queue->type = type;
+    queue->stable = stable;
+    queue->sequence = 0;
+    queue->Capacity = initialCapacity;
     queue->Size = 0;
 }
 
-PriorityQueue *PriorityQueueNew(const unsigned int initialCapacity,
-                                const unsigned long elementSize) {
+PriorityQueue *PriorityQueueNew(const size_t initialCapacity,
+                                const unsigned long elementSize,
+                                const PriorityQueueType type,
+                                const Bool stable) {
     PriorityQueue *queue = (PriorityQueue *)malloc(sizeof(PriorityQueue));
-    PriorityQueueConstruct(queue, initialCapacity, elementSize);
+    PriorityQueueConstruct(queue, initialCapacity, elementSize, type, stable);
     return queue;
 }
 
 void PriorityQueueDestruct(PriorityQueue *const restrict queue) {
-    PriorityQueueNode *temp = NULL;
     if (queue == NULL) return;
 
-    for (unsigned int i = 0; i < queue->Size; i++) {
-        temp = (PriorityQueueNode *)(queue->heap->array +
-                                     i * sizeof(PriorityQueueNode));
-        PriorityQueueNodeDestruct(temp);
-    }
-    ArrayHeapDelete(&queue->heap);
+    free(queue->array);
+    queue->array = NULL;
     queue->elementSize = 0;
+    queue->nodeSize = 0;
+    queue->sequence = 0;
+    queue->Capacity = 0;
+    queue->Size = 0;
 }
 
 void PriorityQueueDelete(PriorityQueue **const restrict queue) {
@@ -93,25 +139,107 @@ void PriorityQueueDelete(PriorityQueue **const restrict queue) {
 void *PriorityQueueFront(const PriorityQueue *const restrict queue) {
     assert(queue != NULL);
     assert(queue->Size > 0);
-    PriorityQueueNode *temp = (PriorityQueueNode *)ArrayHeapTop(queue->heap);
-    return temp->value;
+    return __node(queue, 0)->value;
 }
 
-void PriorityQueuePush(PriorityQueue *const restrict queue, const int priority,
+PriorityQueuePriority PriorityQueueFrontPriority(
+    const PriorityQueue *const restrict queue) {
+    assert(queue != NULL);
+    assert(queue->Size > 0);
+    return __node(queue, 0)->priority;
+}
+
+void PriorityQueuePush(PriorityQueue *const restrict queue,
+                       const PriorityQueuePriority priority,
                        const void *const restrict value) {
     assert(queue != NULL);
     assert(value != NULL);
+    void *temp = NULL;
+    PriorityQueueNode *node = NULL;
+    size_t current = queue->Size, parent = 0;
+    unsigned long long sequence = queue->stable ? queue->sequence++ : 0;
 
-    PriorityQueueNode node;
-    PriorityQueueNodeConstruct(&node, priority, value, queue->elementSize);
-    ArrayHeapPush(queue->heap, &node);
-    queue->Size = queue->heap->Size;
+    if (queue->Size == queue->Capacity) {
+        assert(queue->Capacity <= SIZE_MAX / queue->nodeSize / 2);
+        queue->Capacity *= 2;
+        temp = realloc(queue->array, queue->Capacity * queue->nodeSize);
+        assert(temp != NULL);
+        queue->array = temp;
+    }
+    while (current != 0) {
+        parent = (current - 1) / 2;
+        node = __node(queue, parent);
+        if (!__before(queue, priority, sequence, node->priority,
+                      node->sequence))
+            break;
+        memcpy(__node(queue, current), __node(queue, parent), queue->nodeSize);
+        current = parent;
+    }
+    node = __node(queue, current);
+    node->priority = priority;
+    node->sequence = sequence;
+    memcpy(node->value, value, queue->elementSize);
+    queue->Size++;
 }
 
 void PriorityQueuePop(PriorityQueue *const restrict queue) {
     assert(queue != NULL);
-    ArrayHeapPop(queue->heap);
-    queue->Size = queue->heap->Size;
+    assert(queue->Size > 0);
+    PriorityQueueNode *last = NULL, *node = NULL;
+
+    queue->Size--;
+    if (queue->Size == 0) return;
+    last = __node(queue, queue->Size);
+    node = __PriorityQueueSiftDown(queue, last->priority, last->sequence);
+    memcpy(node, last, queue->nodeSize);
+}
+
+void PriorityQueuePopInto(PriorityQueue *const restrict queue,
+                          void *const restrict output) {
+    assert(queue != NULL);
+    assert(output != NULL);
+    assert(queue->Size > 0);
+
+    memcpy(output, __node(queue, 0)->value, queue->elementSize);
+    PriorityQueuePop(queue);
+}
+
+void PriorityQueueReplaceTop(PriorityQueue *const restrict queue,
+                             const PriorityQueuePriority priority,
+                             const void *const restrict value) {
+    assert(queue != NULL);
+    assert(value != NULL);
+    assert(queue->Size > 0);
+    PriorityQueueNode *node = NULL;
+    unsigned long long sequence = queue->stable ? queue->sequence++ : 0;
+
+    node = __PriorityQueueSiftDown(queue, priority, sequence);
+    node->priority = priority;
+    node->sequence = sequence;
+    memcpy(node->value, value, queue->elementSize);
+}
+
+void PriorityQueuePushPop(PriorityQueue *const restrict queue,
+                          const PriorityQueuePriority priority,
+                          const void *const restrict value,
+                          void *const restrict output) {
+    assert(queue != NULL);
+    assert(value != NULL);
+    assert(output != NULL);
+    PriorityQueueNode *node = NULL;
+    unsigned long long sequence = queue->stable ? queue->sequence++ : 0;
+
+    if (queue->Size == 0 ||
+        !__before(queue, __node(queue, 0)->priority,
+                  __node(queue, 0)->sequence, priority, sequence)) {
+        memcpy(output, value, queue->elementSize);
+        return;
+    }
+    memcpy(output, __node(queue, 0)->value, queue->elementSize);
+    node = __PriorityQueueSiftDown(queue, priority, sequence);
+    node->priority = priority;
+    node->sequence = sequence;
+    memcpy(node->value, value, queue->elementSize);
 }
 
 Bool PriorityQueueSome(PriorityQueue *const restrict queue,
@@ -119,11 +247,8 @@ Bool PriorityQueueSome(PriorityQueue *const restrict queue,
     assert(queue != NULL);
     assert(test != NULL);
 
-    PriorityQueueNode *temp = NULL;
-    for (unsigned int i = 0; i < queue->Size; i++) {
-        temp = (PriorityQueueNode *)(queue->heap->array +
-                                     i * sizeof(PriorityQueueNode));
-        if (test(temp->value) == TRUE) return TRUE;
+    for (size_t i = 0; i < queue->Size; i++) {
+        if (test(__node(queue, i)->value) == TRUE) return TRUE;
     }
     return FALSE;
 }
@@ -133,29 +258,63 @@ Bool PriorityQueueAll(PriorityQueue *const restrict queue,
     assert(queue != NULL);
     assert(test != NULL);
 
-    PriorityQueueNode *temp = NULL;
-    for (unsigned int i = 0; i < queue->Size; i++) {
-        temp = (PriorityQueueNode *)(queue->heap->array +
-                                     i * sizeof(PriorityQueueNode));
-        if (test(temp->value) == FALSE) return FALSE;
+    for (size_t i = 0; i < queue->Size; i++) {
+        if (test(__node(queue, i)->value) == FALSE) return FALSE;
     }
     return TRUE;
 }
 
+/**
+ * @brief Copy values of `queue` into chunks of up to 64 values and pass every
+ * chunk into `test()`, until a chunk decides the result. O(n).
+ *
+ * @param queue Queue to be tested.
+ * @param test Batch test function.
+ * @param some If `TRUE`, a set bit decides. Otherwise, a clear bit decides.
+ * @return Bool Whether some chunk decided the result.
+ */
+static Bool __PriorityQueueBatch(PriorityQueue *const restrict queue,
+                                 BatchTestFunction *const test,
+                                 const Bool some) {
+    __BatchTestChunk chunk = {malloc(64 * queue->elementSize), 0,
+                              queue->elementSize, test, some};
+    assert(chunk.values != NULL);
+    Bool decided = FALSE;
+    for (size_t i = 0; i < queue->Size && !decided; i++) {
+        decided = __BatchTestChunkPush(&chunk, __node(queue, i)->value);
+    }
+    if (!decided) decided = __BatchTestChunkFlush(&chunk);
+    free(chunk.values);
+    return decided;
+}
+
+Bool PriorityQueueSomeBatch(PriorityQueue *const restrict queue,
+                            BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+    return __PriorityQueueBatch(queue, test, TRUE);
+}
+
+Bool PriorityQueueAllBatch(PriorityQueue *const restrict queue,
+                           BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+    return !__PriorityQueueBatch(queue, test, FALSE);
+}
+
 PriorityQueueIterator PriorityQueueGetIterator(
     PriorityQueue *const restrict queue) {
     assert(queue != NULL);
-    PriorityQueueIterator iterator = {queue->heap->array,
-                                      queue->heap->elementSize, 0, queue->Size};
+    PriorityQueueIterator iterator = {queue->array, queue->nodeSize, 0,
+                                      queue->Size};
     return iterator;
 }
 
 PriorityQueueIterator PriorityQueueGetReverseIterator(
     PriorityQueue *const restrict queue) {
     assert(queue != NULL);
-    PriorityQueueIterator iterator = {queue->heap->array,
-                                      queue->heap->elementSize, queue->Size - 1,
-                                      queue->Size};
+    PriorityQueueIterator iterator = {queue->array, queue->nodeSize,
+                                      queue->Size - 1, queue->Size};
     return iterator;
 }
 
@@ -5,7 +5,29 @@
 #include "types.h"
 
 /**
- * @brief Type of element in `PriorityQueue`.
+ * @brief Type of priorities in `PriorityQueue`. It is decided while
+ * constructing the queue and can't be changed.
+ */
+typedef enum {
+    PRIORITY_QUEUE_INT64 = 0,
+    PRIORITY_QUEUE_UINT64 = 1,
+    PRIORITY_QUEUE_DOUBLE = 2
+} PriorityQueueType;
+
+/**
+ * @brief Priority of an element in `PriorityQueue`. Only the member matching
+ * `PriorityQueueType` of the queue will be read.
+ * @attention `NaN` is not a valid `Double` priority.
+ */
+typedef union {
+    long long Int64;
+    unsigned long long UInt64;
+    double Double;
+} PriorityQueuePriority;
+
+/**
+ * @brief Type of element in `PriorityQueue`. Value of the element is stored
+ * right after this header in the same slot.
  * @attention It is no recommended to use this struct.
  */
 typedef struct {
@@ -13,18 +35,26 @@ typedef struct {
      * @private
      * @brief Priority of this node.
      */
-    int priority;
+    PriorityQueuePriority priority;
+    /**
+     * @private
+     * @brief Push order of this node. It is always `0` if the queue is not
+     * stable.
+     */
+    unsigned long long sequence;
     /**
      * @private
      * @brief Value of this node.
      */
-    void *value;
+    unsigned char value[];
 } PriorityQueueNode;
 
 typedef ArrayHeapIterator PriorityQueueIterator;
 
 /**
- * @brief This struct is implemented by `ArrayHeap`.
+ * @brief The element with the highest priority is always in front. Nodes are
+ * stored inline in an array heap, and priorities are compared directly instead
+ * of through `CompareFunction`.
  * @attention There is no similar struct implemented by `LinkedHeap`. Because
  * level order traversal is needed while pushing element into `LinkedHeap`,
  * which will use queue.
@@ -36,18 +66,43 @@ typedef ArrayHeapIterator PriorityQueueIterator;
 typedef struct {
     /**
      * @private
-     * @brief Heap.
+     * @brief All nodes will be stored in this member.
      * @warning Don't modify this member directly. It is maintained
      * automatically.
      * @see `PriorityQueueFront()`, `PriorityQueuePush()`, `PriorityQueuePop()`.
      */
-    ArrayHeap *heap;
+    void *array;
     /**
      * @private
      * @brief Element size of this queue.
      * @warning Don't modify this member directly.
      */
     unsigned long elementSize;
+    /**
+     * @private
+     * @brief Size of a node, including its value and padding.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long nodeSize;
+    /**
+     * @private
+     * @brief Type of priorities.
+     * @warning Don't modify this member directly.
+     */
+    PriorityQueueType type;
+    /**
+     * @private
+     * @brief If `TRUE`, elements with equal priorities will be popped in the
+     * order they are pushed.
+     * @warning Don't modify this member directly.
+     */
+    Bool stable;
+    /**
+     * @private
+     * @brief Sequence number of the next pushed element.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long long sequence;
 
     /**
      * @public
@@ -55,79 +110,57 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
+    /**
+     * @public
+     * @brief Current element capacity of this queue. If `Size` is going to be
+     * larger than `Capacity`, this queue will automatically expand its
+     * capacity.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Capacity;
 } PriorityQueue;
 
-/**
- * @brief Construct function. O(1).
- *
- * @param node Target to be constructed.
- * @param priority Priority of `node`.
- * @param value Value of `node`. It will be DEEP copied.
- * @param elementSize Size of `value`.
- */
-void PriorityQueueNodeConstruct(PriorityQueueNode *const restrict node,
-                                const int priority,
-                                const void *const restrict value,
-                                unsigned long elementSize);
-
-/**
- * @brief Allocate a new node in heap. O(1).
- *
- * @param value Value of node. It will be DEEP copied.
- * @param priority Priority of node.
- * @param elementSize Size of `value`.
- * @return PriorityQueueNode* Pointer refering to a heap address.
- */
-PriorityQueueNode *PriorityQueueNodeNew(const int priority,
-                                        const void *const restrict value,
-                                        unsigned long elementSize);
-
-/**
- * @brief Destruct function. O(1).
- *
- * @param node Target to be destructed. If `NULL`, nothing will happen.
- */
-void PriorityQueueNodeDestruct(PriorityQueueNode *const restrict node);
-
-/**
- * @brief Release `node` in heap. O(1).
- *
- * @param node Pointer refers to the target which is to be deleted. The target
- * will be set to `NULL`. If `NULL`, nothing will happen.
- */
-void PriorityQueueNodeDelete(PriorityQueueNode **const restrict node);
-
 /**
  * @brief Constructor function. O(1).
  *
  * @param queue Target to be constructed.
  * @param initialCapacity Initial capacity of `queue`.
  * @param elementSize Element size of `queue`.
+ * @param type Type of priorities.
+ * @param stable If `TRUE`, elements with equal priorities will be popped in
+ * the order they are pushed.
  */
 void PriorityQueueConstruct(PriorityQueue *const restrict queue,
-                            const unsigned int initialCapacity,
-                            const unsigned long elementSize);
+                            const size_t initialCapacity,
+                            const unsigned long elementSize,
+                            const PriorityQueueType type, const Bool stable);
 
 /**
- * @brief Allocate a new queue in queue. O(1).
+ * @brief Allocate a new queue in heap. O(1).
  *
  * @param initialCapacity Initial capacity of queue.
  * @param elementSize Element size of queue.
- * @return PriorityQueue* Pointer refering to a queue address.
+ * @param type Type of priorities.
+ * @param stable If `TRUE`, elements with equal priorities will be popped in
+ * the order they are pushed.
+ * @return PriorityQueue* Pointer refering to a heap address.
  */
-PriorityQueue *PriorityQueueNew(const unsigned int initialCapacity,
-                                const unsigned long elementSize);
+PriorityQueue *PriorityQueueNew(const size_t initialCapacity,
+                                const unsigned long elementSize,
+                                const PriorityQueueType type,
+                                const Bool stable);
 
 /**
- * @brief Destruct function. O(n).
+ * @brief Destruct function. O(1).
  *
  * @param queue Target to be destructed. If `NULL`, nothing will happen.
  */
 void PriorityQueueDestruct(PriorityQueue *const restrict queue);
 
 /**
- * @brief Release `queue` in queue. O(n).
+ * @brief Release `queue` in heap. O(1).
  *
  * @param queue Pointer refers to the target which is to be deleted. The
  * target will be set to `NULL`. If `NULL`, nothing will happen.
@@ -144,13 +177,24 @@ void PriorityQueueDelete(PriorityQueue **const restrict queue);
  */
 void *PriorityQueueFront(const PriorityQueue *const restrict queue);
 
+/**
+ * @brief Get priority of the first element of `queue`. O(1).
+ *
+ * @param queue `this`.
+ * @return PriorityQueuePriority Priority of the element.
+ */
+PriorityQueuePriority PriorityQueueFrontPriority(
+    const PriorityQueue *const restrict queue);
+
 /**
  * @brief Add a new element into `queue. O(log₂n).
  *
  * @param queue `this`.
+ * @param priority Priority of element.
  * @param value Value of element. It will be DEEP copied.
  */
-void PriorityQueuePush(PriorityQueue *const restrict queue, const int priority,
+void PriorityQueuePush(PriorityQueue *const restrict queue,
+                       const PriorityQueuePriority priority,
                        const void *const restrict value);
 
 /**
@@ -160,6 +204,44 @@ void PriorityQueuePush(PriorityQueue *const restrict queue, const int priority,
  */
 void PriorityQueuePop(PriorityQueue *const restrict queue);
 
+/**
+ * @brief Copy value of the first element of `queue` into `output`, and remove
+ * it. O(log₂n).
+ *
+ * @param queue `this`.
+ * @param output Pointer refers to memory which can hold a value.
+ */
+void PriorityQueuePopInto(PriorityQueue *const restrict queue,
+                          void *const restrict output);
+
+/**
+ * @brief Replace the first element of `queue` with a new element. It equals to
+ * `PriorityQueuePop()` followed by `PriorityQueuePush()`, but only sifts once.
+ * O(log₂n).
+ *
+ * @param queue `this`.
+ * @param priority Priority of element.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void PriorityQueueReplaceTop(PriorityQueue *const restrict queue,
+                             const PriorityQueuePriority priority,
+                             const void *const restrict value);
+
+/**
+ * @brief Add a new element into `queue`, then remove the first element of
+ * `queue` and copy its value into `output`. If the new element would be the
+ * first, `queue` is not modified. O(log₂n).
+ *
+ * @param queue `this`.
+ * @param priority Priority of element.
+ * @param value Value of element. It will be DEEP copied.
+ * @param output Pointer refers to memory which can hold a value.
+ */
+void PriorityQueuePushPop(PriorityQueue *const restrict queue,
+                          const PriorityQueuePriority priority,
+                          const void *const restrict value,
+                          void *const restrict output);
+
 /**
  * @brief Every value of elements in `queue` will be passed into `test()`. If
  * `test()` returns `TRUE`, `TRUE` will be returned immediately. If `FALSE` is
@@ -190,6 +272,34 @@ Bool PriorityQueueSome(PriorityQueue *const restrict queue,
 Bool PriorityQueueAll(PriorityQueue *const restrict queue,
                       TestFunction *const test);
 
+/**
+ * @brief Values of elements in `queue` will be passed into `test()` in gathered
+ * chunks of up to 64 values. If any bit is returned set, `TRUE` will be
+ * returned immediately. Otherwise, `FALSE` will be returned. O(n).
+ * @attention Values are NOT passed in priority order.
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool PriorityQueueSomeBatch(PriorityQueue *const restrict queue,
+                            BatchTestFunction *const test);
+
+/**
+ * @brief Values of elements in `queue` will be passed into `test()` in gathered
+ * chunks of up to 64 values. If any bit is returned clear, `FALSE` will be
+ * returned immediately. Otherwise, `TRUE` will be returned. O(n).
+ * @attention Values are NOT passed in priority order.
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool PriorityQueueAllBatch(PriorityQueue *const restrict queue,
+                           BatchTestFunction *const test);
+
 /**
  * @brief Get iterator of `queue`. O(1).
  *
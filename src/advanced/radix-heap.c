@@ -0,0 +1,125 @@
+#include "radix-heap.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+
+/**
+ * @brief Get index of the bucket which `key` belongs to. O(1).
+ *
+ * @param key Key of node.
+ * @param last Smallest key of heap.
+ * @return unsigned int Index of bucket.
+ */
+static inline unsigned int __bucket(const unsigned long long key,
+                                    const unsigned long long last) {
+    if (key == last) return 0;
+    return 64 - __builtin_clzll(key ^ last);
+}
+
+/**
+ * @brief Make sure that `buckets[0]` is not empty. All the nodes in the
+ * first non-empty bucket are redistributed into lower buckets.
+ *
+ * @param heap `this`.
+ */
+static void __RadixHeapRefill(RadixHeap *const restrict heap) {
+    unsigned int i = 1;
+    RadixHeapNode *node = NULL;
+    ArrayStack *bucket = NULL;
+    if (heap->buckets[0].Size > 0) return;
+
+    while (heap->buckets[i].Size == 0) i++;
+    bucket = &heap->buckets[i];
+    heap->last = ((RadixHeapNode *)ArrayStackTop(bucket))->key;
+    for (size_t j = 0; j < bucket->Size; j++) {
+        node = (RadixHeapNode *)(bucket->array + j * bucket->elementSize);
+        if (node->key < heap->last) heap->last = node->key;
+    }
+    while (bucket->Size > 0) {
+        node = (RadixHeapNode *)ArrayStackTop(bucket);
+        ArrayStackPush(&heap->buckets[__bucket(node->key, heap->last)], node);
+        ArrayStackPop(bucket);
+    }
+}
+
+void RadixHeapConstruct(RadixHeap *const restrict heap,
+                        const unsigned long elementSize) {
+    assert(heap != NULL);
+    assert(elementSize > 0);
+
+    heap->nodeSize = sizeof(RadixHeapNode) + elementSize;
+    heap->nodeSize += (_Alignof(RadixHeapNode) -
+                       heap->nodeSize % _Alignof(RadixHeapNode)) %
+                      _Alignof(RadixHeapNode);
+    for (unsigned int i = 0; i < 65; i++) {
+        ArrayStackConstruct(&heap->buckets[i], 1, heap->nodeSize);
+    }
+    heap->cache = (RadixHeapNode *)malloc(heap->nodeSize);
+    assert(heap->cache != NULL);
+    heap->elementSize = elementSize;
+    heap->last = 0;
+    heap->Size = 0;
+}
+
+RadixHeap *RadixHeapNew(const unsigned long elementSize) {
+    RadixHeap *heap = (RadixHeap *)malloc(sizeof(RadixHeap));
+    RadixHeapConstruct(heap, elementSize);
+    return heap;
+}
+
+void RadixHeapDestruct(RadixHeap *const restrict heap) {
+    if (heap == NULL) return;
+
+    for (unsigned int i = 0; i < 65; i++) {
+        ArrayStackDestruct(&heap->buckets[i]);
+    }
+    free(heap->cache);
+    heap->cache = NULL;
+    heap->elementSize = 0;
+    heap->nodeSize = 0;
+    heap->last = 0;
+    heap->Size = 0;
+}
+
+void RadixHeapDelete(RadixHeap **const restrict heap) {
+    if (heap == NULL) return;
+
+    RadixHeapDestruct(*heap);
+    free(*heap);
+    *heap = NULL;
+}
+
+void *RadixHeapFront(RadixHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    __RadixHeapRefill(heap);
+    return ((RadixHeapNode *)ArrayStackTop(&heap->buckets[0]))->value;
+}
+
+unsigned long long RadixHeapFrontKey(RadixHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    __RadixHeapRefill(heap);
+    return heap->last;
+}
+
+void RadixHeapPush(RadixHeap *const restrict heap, const unsigned long long key,
+                   const void *const restrict value) {
+    assert(heap != NULL);
+    assert(value != NULL);
+    assert(key >= heap->last);
+
+    heap->cache->key = key;
+    memcpy(heap->cache->value, value, heap->elementSize);
+    ArrayStackPush(&heap->buckets[__bucket(key, heap->last)], heap->cache);
+    heap->Size++;
+}
+
+void RadixHeapPop(RadixHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    __RadixHeapRefill(heap);
+    ArrayStackPop(&heap->buckets[0]);
+    heap->Size--;
+}
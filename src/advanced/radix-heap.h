@@ -0,0 +1,147 @@
+#ifndef __COLLECTIONS_RADIX_HEAP__
+#define __COLLECTIONS_RADIX_HEAP__
+
+#include "array-stack.h"
+#include "types.h"
+
+/**
+ * @brief Type of element in `RadixHeap`. Value of the element is stored right
+ * after this header in the same slot.
+ * @attention It is no recommended to use this struct.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Key of this node.
+     */
+    unsigned long long key;
+    /**
+     * @private
+     * @brief Value of this node.
+     */
+    unsigned char value[];
+} RadixHeapNode;
+
+/**
+ * @brief Monotone priority queue for unsigned integer keys. The element with
+ * the SMALLEST key is always in front, and a pushed key must not be smaller
+ * than the key of the last popped element. Push is O(1) and pop is amortized
+ * O(log₂C), where C is the largest key.
+ * @attention Unlike `PriorityQueue`, the smallest key is served first.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `RadixHeapConstruct()`, `RadixHeapNew()`, `RadixHeapDestruct()`,
+ * `RadixHeapDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Nodes whose keys have the highest bit differing from `last` at
+     * position `i - 1` will be stored in `buckets[i]`. Nodes whose keys are
+     * equal to `last` will be stored in `buckets[0]`.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `RadixHeapFront()`, `RadixHeapPush()`, `RadixHeapPop()`.
+     */
+    ArrayStack buckets[65];
+    /**
+     * @private
+     * @brief Node used in building the pushed node.
+     * @warning Don't modify this member directly.
+     */
+    RadixHeapNode *cache;
+    /**
+     * @private
+     * @brief Element size of this heap.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Size of a node, including its value and padding.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long nodeSize;
+    /**
+     * @private
+     * @brief Smallest key of this heap. No smaller key can be pushed.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long long last;
+
+    /**
+     * @public
+     * @brief Current element quantity of this heap.
+     * @attention Don't modify the value of this member directly. It is
+     * maintained automatically.
+     */
+    size_t Size;
+} RadixHeap;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param heap Target to be constructed.
+ * @param elementSize Element size of `heap`.
+ */
+void RadixHeapConstruct(RadixHeap *const restrict heap,
+                        const unsigned long elementSize);
+
+/**
+ * @brief Allocate a new heap in heap. O(1).
+ *
+ * @param elementSize Element size of heap.
+ * @return RadixHeap* Pointer refering to a heap address.
+ */
+RadixHeap *RadixHeapNew(const unsigned long elementSize);
+
+/**
+ * @brief Destruct function. O(1).
+ *
+ * @param heap Target to be destructed. If `NULL`, nothing will happen.
+ */
+void RadixHeapDestruct(RadixHeap *const restrict heap);
+
+/**
+ * @brief Release `heap` in heap. O(1).
+ *
+ * @param heap Pointer refers to the target which is to be deleted. The
+ * target will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void RadixHeapDelete(RadixHeap **const restrict heap);
+
+/**
+ * @brief Get value of the element with the smallest key. Amortized O(log₂C).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param heap `this`.
+ * @return void* Value of the element.
+ */
+void *RadixHeapFront(RadixHeap *const restrict heap);
+
+/**
+ * @brief Get the smallest key in `heap`. Amortized O(log₂C).
+ *
+ * @param heap `this`.
+ * @return unsigned long long Key of the element.
+ */
+unsigned long long RadixHeapFrontKey(RadixHeap *const restrict heap);
+
+/**
+ * @brief Add a new element into `heap`. O(1).
+ *
+ * @param heap `this`.
+ * @param key Key of element. It must not be smaller than the key of the last
+ * popped element.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void RadixHeapPush(RadixHeap *const restrict heap, const unsigned long long key,
+                   const void *const restrict value);
+
+/**
+ * @brief Remove the element with the smallest key. Amortized O(log₂C).
+ *
+ * @param heap `this`.
+ */
+void RadixHeapPop(RadixHeap *const restrict heap);
+
+#endif  // __COLLECTIONS_RADIX_HEAP__
@@ -0,0 +1,252 @@
+#include "timer-wheel.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+
+/**
+ * @brief Get the index of the slot which holds `node` in its level. O(1).
+ *
+ * @param node Node in a wheel.
+ * @return unsigned int Index of the slot.
+ */
+static inline unsigned int __index(const TimerWheelNode *const node) {
+    return (node->expire >> (node->level * 8)) & 255;
+}
+
+/**
+ * @brief Get the slot which holds `node`. O(1).
+ *
+ * @param wheel `this`.
+ * @param node Node in `wheel`.
+ * @return TimerWheelNode** Head of the slot.
+ */
+static inline TimerWheelNode **__slot(TimerWheel *const restrict wheel,
+                                      const TimerWheelNode *const node) {
+    return &wheel->slots[node->level][__index(node)];
+}
+
+/**
+ * @brief Find the first non-empty slot of `level` whose index is not less
+ * than `from`. O(1).
+ *
+ * @param wheel `this`.
+ * @param level Level of slots.
+ * @param from Index to start from. It may be 256.
+ * @return unsigned int Index of the slot, or 256 if there is no such slot.
+ */
+static unsigned int __TimerWheelFind(const TimerWheel *const restrict wheel,
+                                     const unsigned int level,
+                                     const unsigned int from) {
+    unsigned long long bits = 0;
+    for (unsigned int word = from / 64; word < 4; word++) {
+        bits = wheel->occupied[level][word];
+        if (word == from / 64) bits &= ~0ULL << (from % 64);
+        if (bits != 0) return word * 64 + __builtin_ctzll(bits);
+    }
+    return 256;
+}
+
+/**
+ * @brief Get the earliest tick after current time on which a slot of `wheel`
+ * has to be expired or cascaded. O(1).
+ *
+ * @param wheel `this`, which holds at least one timer.
+ * @return unsigned long long The tick.
+ */
+static unsigned long long __TimerWheelNext(
+    const TimerWheel *const restrict wheel) {
+    unsigned int shift = 0, index = 0;
+    unsigned long long high = 0;
+
+    // every tick reached by a level comes before those of higher levels
+    for (unsigned int level = 0; level < 8; level++) {
+        shift = level * 8;
+        index = __TimerWheelFind(wheel, level,
+                                 ((wheel->Current >> shift) & 255) + 1);
+        if (index == 256) continue;
+        // slots of a level share the higher bytes of current time
+        high = level == 7 ? 0 : wheel->Current >> (shift + 8) << (shift + 8);
+        return high | (unsigned long long)index << shift;
+    }
+    assert(wheel->Size == 0);
+    return ~0ULL;
+}
+
+/**
+ * @brief Link `node` into the slot determined by its expiration time and
+ * current time of `wheel`. O(1).
+ *
+ * @param wheel `this`.
+ * @param node Node whose expiration time is not earlier than current time.
+ */
+static void __TimerWheelPlace(TimerWheel *const restrict wheel,
+                              TimerWheelNode *const restrict node) {
+    TimerWheelNode **slot = NULL;
+    unsigned long long difference = node->expire ^ wheel->Current;
+
+    // the highest byte which differs from current time decides the level
+    node->level =
+        difference == 0 ? 0 : (63 - __builtin_clzll(difference)) / 8;
+    slot = __slot(wheel, node);
+    node->previous = NULL;
+    node->next = *slot;
+    if (*slot != NULL) (*slot)->previous = node;
+    *slot = node;
+    wheel->occupied[node->level][__index(node) / 64] |=
+        1ULL << (__index(node) % 64);
+}
+
+/**
+ * @brief Unlink `node` from its slot. O(1).
+ *
+ * @param wheel `this`.
+ * @param node Node in `wheel`.
+ */
+static void __TimerWheelUnlink(TimerWheel *const restrict wheel,
+                               TimerWheelNode *const restrict node) {
+    if (node->previous == NULL) {
+        *__slot(wheel, node) = node->next;
+        if (node->next == NULL) {
+            wheel->occupied[node->level][__index(node) / 64] &=
+                ~(1ULL << (__index(node) % 64));
+        }
+    } else {
+        node->previous->next = node->next;
+    }
+    if (node->next != NULL) node->next->previous = node->previous;
+    node->previous = NULL;
+    node->next = NULL;
+}
+
+/**
+ * @brief Move every node of a higher level slot into lower levels. O(m).
+ *
+ * @param wheel `this`.
+ * @param level Level of the slot to be cascaded.
+ * @param index Index of the slot to be cascaded.
+ */
+static void __TimerWheelCascade(TimerWheel *const restrict wheel,
+                                const unsigned int level,
+                                const unsigned int index) {
+    TimerWheelNode *node = wheel->slots[level][index], *next = NULL;
+    wheel->slots[level][index] = NULL;
+    wheel->occupied[level][index / 64] &= ~(1ULL << (index % 64));
+    while (node != NULL) {
+        next = node->next;
+        __TimerWheelPlace(wheel, node);
+        node = next;
+    }
+}
+
+void TimerWheelConstruct(TimerWheel *const restrict wheel,
+                         const unsigned long long current,
+                         const unsigned long elementSize) {
+    assert(wheel != NULL);
+    assert(elementSize > 0);
+
+    memset(wheel->slots, 0, sizeof(wheel->slots));
+    memset(wheel->occupied, 0, sizeof(wheel->occupied));
+    wheel->elementSize = elementSize;
+    wheel->Current = current;
+    wheel->Size = 0;
+}
+
+TimerWheel *TimerWheelNew(const unsigned long long current,
+                          const unsigned long elementSize) {
+    TimerWheel *wheel = (TimerWheel *)malloc(sizeof(TimerWheel));
+    TimerWheelConstruct(wheel, current, elementSize);
+    return wheel;
+}
+
+void TimerWheelDestruct(TimerWheel *const restrict wheel) {
+    TimerWheelNode *node = NULL, *temp = NULL;
+    if (wheel == NULL) return;
+
+    for (unsigned int i = 0; i < 8; i++) {
+        for (unsigned int j = 0; j < 256; j++) {
+            node = wheel->slots[i][j];
+            while (node != NULL) {
+                temp = node->next;
+                free(node);
+                node = temp;
+            }
+            wheel->slots[i][j] = NULL;
+        }
+    }
+    memset(wheel->occupied, 0, sizeof(wheel->occupied));
+    wheel->elementSize = 0;
+    wheel->Current = 0;
+    wheel->Size = 0;
+}
+
+void TimerWheelDelete(TimerWheel **const restrict wheel) {
+    if (wheel == NULL) return;
+
+    TimerWheelDestruct(*wheel);
+    free(*wheel);
+    *wheel = NULL;
+}
+
+TimerWheelHandle TimerWheelSchedule(TimerWheel *const restrict wheel,
+                                    const unsigned long long expire,
+                                    const void *const restrict value) {
+    assert(wheel != NULL);
+    assert(value != NULL);
+
+    TimerWheelNode *node =
+        (TimerWheelNode *)malloc(sizeof(TimerWheelNode) + wheel->elementSize);
+    assert(node != NULL);
+    memcpy(node->value, value, wheel->elementSize);
+    // the slot of current tick has been expired already
+    node->expire = expire > wheel->Current ? expire : wheel->Current + 1;
+    __TimerWheelPlace(wheel, node);
+    wheel->Size++;
+    return node;
+}
+
+void TimerWheelCancel(TimerWheel *const restrict wheel,
+                      TimerWheelHandle const restrict handle) {
+    assert(wheel != NULL);
+    assert(handle != NULL);
+    assert(wheel->Size > 0);
+
+    __TimerWheelUnlink(wheel, handle);
+    free(handle);
+    wheel->Size--;
+}
+
+void TimerWheelAdvance(TimerWheel *const restrict wheel,
+                       const unsigned long long time,
+                       VisitFunction *const expire) {
+    assert(wheel != NULL);
+    assert(expire != NULL);
+
+    TimerWheelNode **slot = NULL, *node = NULL;
+    unsigned long long next = 0;
+    unsigned int level = 0;
+    while (wheel->Current < time) {
+        // ticks before `next` touch empty slots only, so they are skipped
+        next = wheel->Size == 0 ? time : __TimerWheelNext(wheel);
+        if (next > time) next = time;
+        wheel->Current = next;
+        if ((wheel->Current & 255) == 0) {
+            // cascade from the highest level whose slot index moves
+            level = __builtin_ctzll(wheel->Current) / 8;
+            if (level > 7) level = 7;
+            for (; level > 0; level--) {
+                __TimerWheelCascade(wheel, level,
+                                    (wheel->Current >> (level * 8)) & 255);
+            }
+        }
+        // nodes are unlinked one by one, so `expire()` may cancel any of them
+        slot = &wheel->slots[0][wheel->Current & 255];
+        while (*slot != NULL) {
+            node = *slot;
+            __TimerWheelUnlink(wheel, node);
+            wheel->Size--;
+            expire(node->value);
+            free(node);
+        }
+    }
+}
@@ -0,0 +1,174 @@
+#ifndef __COLLECTIONS_TIMER_WHEEL__
+#define __COLLECTIONS_TIMER_WHEEL__
+
+#include "types.h"
+
+/**
+ * @brief Type of element in `TimerWheel`. It is an intrusive variant of
+ * `DelinkedListNode`, whose value is stored right after this header in the
+ * same allocation.
+ * @attention It is no recommended to use this struct.
+ */
+typedef struct __TimerWheelNode {
+    /**
+     * @private
+     * @brief Pointer refers to the previous node in the same slot.
+     */
+    struct __TimerWheelNode *previous;
+    /**
+     * @private
+     * @brief Pointer refers to the next node in the same slot.
+     */
+    struct __TimerWheelNode *next;
+    /**
+     * @private
+     * @brief Expiration time of this node.
+     */
+    unsigned long long expire;
+    /**
+     * @private
+     * @brief Level of the slot which holds this node.
+     */
+    unsigned int level;
+    /**
+     * @private
+     * @brief Value of this node.
+     */
+    unsigned char value[];
+} TimerWheelNode;
+
+/**
+ * @brief Handle of a scheduled timer. It is used in cancelling the timer.
+ * @attention A handle becomes invalid once its timer is expired or
+ * cancelled.
+ */
+typedef TimerWheelNode *TimerWheelHandle;
+
+/**
+ * @brief Hierarchical timing wheel. Time is measured in ticks. Level `i` has
+ * 256 slots, each of which covers 256ⁱ ticks, so the whole 64-bit time range
+ * is covered without overflow lists.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `TimerWheelConstruct()`, `TimerWheelNew()`, `TimerWheelDestruct()`,
+ * `TimerWheelDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Heads of slots.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `TimerWheelSchedule()`, `TimerWheelCancel()`,
+     * `TimerWheelAdvance()`.
+     */
+    TimerWheelNode *slots[8][256];
+    /**
+     * @private
+     * @brief Bitmaps of non-empty slots, one bit per slot. They let
+     * `TimerWheelAdvance()` skip empty slots.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long long occupied[8][4];
+    /**
+     * @private
+     * @brief Element size of this wheel.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+
+    /**
+     * @public
+     * @brief Current time of this wheel.
+     * @attention Don't modify the value of this member directly. Please use
+     * `TimerWheelAdvance()`.
+     */
+    unsigned long long Current;
+    /**
+     * @public
+     * @brief Current timer quantity of this wheel.
+     * @attention Don't modify the value of this member directly. It is
+     * maintained automatically.
+     */
+    size_t Size;
+} TimerWheel;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param wheel Target to be constructed.
+ * @param current Initial time of `wheel`.
+ * @param elementSize Element size of `wheel`.
+ */
+void TimerWheelConstruct(TimerWheel *const restrict wheel,
+                         const unsigned long long current,
+                         const unsigned long elementSize);
+
+/**
+ * @brief Allocate a new wheel in heap. O(1).
+ *
+ * @param current Initial time of wheel.
+ * @param elementSize Element size of wheel.
+ * @return TimerWheel* Pointer refering to a heap address.
+ */
+TimerWheel *TimerWheelNew(const unsigned long long current,
+                          const unsigned long elementSize);
+
+/**
+ * @brief Destruct function. Pending timers are released without being
+ * expired. O(n).
+ *
+ * @param wheel Target to be destructed. If `NULL`, nothing will happen.
+ */
+void TimerWheelDestruct(TimerWheel *const restrict wheel);
+
+/**
+ * @brief Release `wheel` in heap. O(n).
+ *
+ * @param wheel Pointer refers to the target which is to be deleted. The
+ * target will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void TimerWheelDelete(TimerWheel **const restrict wheel);
+
+/**
+ * @brief Schedule a new timer. O(1).
+ *
+ * @param wheel `this`.
+ * @param expire Expiration time. If it is not later than `wheel->Current`,
+ * the timer will expire on the next tick.
+ * @param value Value of timer. It will be DEEP copied.
+ * @return TimerWheelHandle Handle used in cancelling the timer.
+ */
+TimerWheelHandle TimerWheelSchedule(TimerWheel *const restrict wheel,
+                                    const unsigned long long expire,
+                                    const void *const restrict value);
+
+/**
+ * @brief Cancel a pending timer. Its value is released without being
+ * expired. O(1).
+ *
+ * @param wheel `this`.
+ * @param handle Handle returned by `TimerWheelSchedule()`.
+ */
+void TimerWheelCancel(TimerWheel *const restrict wheel,
+                      TimerWheelHandle const restrict handle);
+
+/**
+ * @brief Move time of `wheel` forward to `time`. Every timer which expires
+ * until then is removed and its value is passed into `expire()`, in order of
+ * expiration time. Timers expiring on the same tick are handled as one batch.
+ * Empty slots are skipped, so the cost does not depend on the elapsed time.
+ * O(s + m), where s is the number of non-empty slots reached and m is the
+ * number of moved timers.
+ * @attention `expire()` may schedule and cancel timers. The value passed into
+ * `expire()` is released after it returns.
+ *
+ * @param wheel `this`.
+ * @param time New time. If it is not later than `wheel->Current`, nothing
+ * will happen.
+ * @param expire Function called with value of every expired timer.
+ */
+void TimerWheelAdvance(TimerWheel *const restrict wheel,
+                       const unsigned long long time,
+                       VisitFunction *const expire);
+
+#endif  // __COLLECTIONS_TIMER_WHEEL__
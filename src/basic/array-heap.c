@@ -3,9 +3,10 @@
 #include <assert.h>
 #include <malloc.h>
 #include <memory.h>
+#include <stdint.h>
 
 void ArrayHeapConstruct(ArrayHeap *const restrict heap,
-                        const unsigned int initialCapacity,
+                        const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare) {
     assert(heap != NULL);
@@ -18,10 +19,16 @@ void ArrayHeapConstruct(ArrayHeap *const restrict heap,
     heap->elementSize = elementSize;
     heap->Capacity = initialCapacity;
     heap->compare = compare;
+    heap->growthFactor = 2;
+    heap->autoShrink = FALSE;
+    heap->incremental = FALSE;
+    heap->previous = NULL;
+    heap->migrated = 0;
+    heap->limit = 0;
     heap->Size = 0;
 }
 
-ArrayHeap *ArrayHeapNew(const unsigned int initialCapacity,
+ArrayHeap *ArrayHeapNew(const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare) {
     ArrayHeap *heap = (ArrayHeap *)malloc(sizeof(ArrayHeap));
@@ -32,7 +39,11 @@ ArrayHeap *ArrayHeapNew(const unsigned int initialCapacity,
 void ArrayHeapDestruct(ArrayHeap *const restrict heap) {
     if (heap == NULL) return;
     free(heap->array);
+    free(heap->previous);
     heap->array = NULL;
+    heap->previous = NULL;
+    heap->migrated = 0;
+    heap->limit = 0;
     heap->Capacity = 0;
     heap->Size = 0;
     heap->elementSize = 0;
@@ -46,79 +57,283 @@ void ArrayHeapDelete(ArrayHeap **const restrict heap) {
     *heap = NULL;
 }
 
+/**
+ * @brief Get element at `index`, wherever it is stored during an incremental
+ * migration. O(1).
+ *
+ * @param heap `this`.
+ * @param index Specified index.
+ * @return void* The element.
+ */
+static inline void *__at(const ArrayHeap *const heap, const size_t index) {
+    if (index >= heap->migrated && index < heap->limit) {
+        return heap->previous + index * heap->elementSize;
+    }
+    return heap->array + index * heap->elementSize;
+}
+
+/**
+ * @brief Move up to `count` pending elements out of `heap->previous`, and
+ * release it once it is empty. O(count).
+ *
+ * @param heap `this`.
+ * @param count Maximum count of moved elements.
+ */
+static void __ArrayHeapMigrate(ArrayHeap *const restrict heap, size_t count) {
+    if (heap->previous == NULL) return;
+    // Popped elements don't need to be moved.
+    if (heap->limit > heap->Size) heap->limit = heap->Size;
+    if (heap->migrated < heap->limit) {
+        if (count > heap->limit - heap->migrated) {
+            count = heap->limit - heap->migrated;
+        }
+        memcpy(heap->array + heap->migrated * heap->elementSize,
+               heap->previous + heap->migrated * heap->elementSize,
+               count * heap->elementSize);
+        heap->migrated += count;
+    }
+    if (heap->migrated >= heap->limit) {
+        free(heap->previous);
+        heap->previous = NULL;
+        heap->migrated = 0;
+        heap->limit = 0;
+    }
+}
+
+/**
+ * @brief Move one step of pending elements, enough to finish the migration
+ * before `heap` is full again. O(1).
+ *
+ * @param heap `this`.
+ */
+static inline void __ArrayHeapStep(ArrayHeap *const restrict heap) {
+    if (heap->previous == NULL) return;
+    __ArrayHeapMigrate(heap,
+                       heap->limit / (heap->Capacity - heap->limit) + 1);
+}
+
+/**
+ * @brief Finish a pending migration, so that all elements are contiguous in
+ * `heap->array`. O(n).
+ *
+ * @param heap `this`.
+ */
+static inline void __ArrayHeapSettle(ArrayHeap *const restrict heap) {
+    if (heap->previous != NULL) __ArrayHeapMigrate(heap, SIZE_MAX);
+}
+
+/**
+ * @brief Reallocate storage of `heap` to hold exactly `capacity` elements.
+ * O(n).
+ *
+ * @param heap `this`.
+ * @param capacity New capacity. It must not be less than `heap->Size`.
+ */
+static void __ArrayHeapResize(ArrayHeap *const restrict heap,
+                              const size_t capacity) {
+    assert(capacity <= SIZE_MAX / heap->elementSize);
+    __ArrayHeapSettle(heap);
+    void *temp = realloc(heap->array, capacity * heap->elementSize);
+    assert(temp != NULL);
+    heap->array = temp;
+    heap->Capacity = capacity;
+}
+
+/**
+ * @brief Make sure that `heap` can hold `size` elements, multiplying its
+ * capacity by the growth factor as many times as needed. O(n).
+ *
+ * @param heap `this`.
+ * @param size Required capacity.
+ */
+static void __ArrayHeapReserve(ArrayHeap *const restrict heap,
+                               const size_t size) {
+    if (size <= heap->Capacity) return;
+    // Growth stops at the largest capacity whose byte size can be represented.
+    const size_t maximum = SIZE_MAX / heap->elementSize;
+    assert(size <= maximum);
+    size_t capacity = heap->Capacity;
+    while (capacity < size) {
+        const double next = capacity * heap->growthFactor;
+        if (next >= maximum) {
+            capacity = maximum;
+        } else {
+            capacity = next >= capacity + 1 ? next : capacity + 1;
+        }
+    }
+    __ArrayHeapResize(heap, capacity);
+}
+
+/**
+ * @brief Make room for one more element of a full `heap`. In incremental mode,
+ * new storage is allocated without copying, and pending elements are moved
+ * by the following operations. O(1) in incremental mode, O(n) otherwise.
+ *
+ * @param heap `this`.
+ */
+static void __ArrayHeapGrow(ArrayHeap *const restrict heap) {
+    if (heap->Size < heap->Capacity) return;
+    if (!heap->incremental || heap->Size == 0) {
+        __ArrayHeapReserve(heap, heap->Size + 1);
+        return;
+    }
+    // The previous migration is always finished before the heap fills up
+    // again, unless the growth factor was changed in between.
+    __ArrayHeapSettle(heap);
+    const size_t maximum = SIZE_MAX / heap->elementSize;
+    assert(heap->Size < maximum);
+    const double next = heap->Capacity * heap->growthFactor;
+    size_t capacity = next >= maximum ? maximum : next;
+    if (capacity <= heap->Capacity) capacity = heap->Capacity + 1;
+    void *temp = malloc(capacity * heap->elementSize);
+    assert(temp != NULL);
+    heap->previous = heap->array;
+    heap->array = temp;
+    heap->migrated = 0;
+    heap->limit = heap->Size;
+    heap->Capacity = capacity;
+}
+
+/**
+ * @brief Reduce capacity of `heap` after removals if automatic shrinking is
+ * enabled and `heap` is sparse enough. O(n) when shrinking, O(1) otherwise.
+ *
+ * @param heap `this`.
+ */
+static void __ArrayHeapShrink(ArrayHeap *const restrict heap) {
+    if (!heap->autoShrink) return;
+    const double factor = heap->growthFactor;
+    if (heap->Size * factor * factor > heap->Capacity) return;
+    const double target = heap->Size * factor;
+    const size_t capacity = target < 1 ? 1 : target;
+    if (capacity < heap->Capacity) __ArrayHeapResize(heap, capacity);
+}
+
+void ArrayHeapSetGrowthFactor(ArrayHeap *const restrict heap,
+                              const double factor) {
+    assert(heap != NULL);
+    assert(factor > 1);
+    heap->growthFactor = factor;
+}
+
+void ArrayHeapSetAutoShrink(ArrayHeap *const restrict heap,
+                            const Bool autoShrink) {
+    assert(heap != NULL);
+    heap->autoShrink = autoShrink;
+}
+
+void ArrayHeapSetIncremental(ArrayHeap *const restrict heap,
+                             const Bool incremental) {
+    assert(heap != NULL);
+    heap->incremental = incremental;
+    if (!incremental) __ArrayHeapSettle(heap);
+}
+
+void ArrayHeapReserve(ArrayHeap *const restrict heap, const size_t capacity) {
+    assert(heap != NULL);
+    if (capacity > heap->Capacity) __ArrayHeapResize(heap, capacity);
+}
+
+void ArrayHeapShrinkToFit(ArrayHeap *const restrict heap) {
+    assert(heap != NULL);
+    const size_t capacity = heap->Size > 0 ? heap->Size : 1;
+    if (capacity != heap->Capacity) __ArrayHeapResize(heap, capacity);
+}
+
 void *ArrayHeapTop(const ArrayHeap *const restrict heap) {
     assert(heap != NULL);
     assert(heap->Size > 0);
-    return heap->array;
+    return __at(heap, 0);
 }
 
 void ArrayHeapPush(ArrayHeap *const restrict heap,
                    const void *const restrict value) {
     assert(heap != NULL);
     assert(value != NULL);
-    void *temp = NULL;
-    unsigned int current = heap->Size, parent = 0;
-    if (heap->Size == heap->Capacity) {
-        heap->Capacity *= 2;
-        temp = calloc(heap->Capacity, heap->elementSize);
-        assert(temp != NULL);
-        memcpy(temp, heap->array, heap->Size * heap->elementSize);
-        free(heap->array);
-        heap->array = temp;
-    }
+    size_t current = heap->Size, parent = 0;
+    __ArrayHeapGrow(heap);
     while (current != 0) {
         parent = current % 2 == 0 ? (current - 1) / 2 : current / 2;
-        if (heap->compare(value, heap->array + parent * heap->elementSize) <= 0)
-            break;
-        memcpy(heap->array + current * heap->elementSize,
-               heap->array + parent * heap->elementSize, heap->elementSize);
+        if (heap->compare(value, __at(heap, parent)) <= 0) break;
+        memcpy(__at(heap, current), __at(heap, parent), heap->elementSize);
         current = parent;
     }
-    memcpy(heap->array + current * heap->elementSize, value, heap->elementSize);
+    memcpy(__at(heap, current), value, heap->elementSize);
     heap->Size++;
+    __ArrayHeapStep(heap);
+}
+
+/**
+ * @brief Move `value` down from the empty top of `heap`. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param value Value to be placed. It must not be inside the first
+ * `heap->Size` elements.
+ */
+static void __ArrayHeapSiftDown(ArrayHeap *const restrict heap,
+                                const void *const restrict value) {
+    size_t current = 0, child = 0;
+    while ((child = current * 2 + 1) < heap->Size) {
+        // choose the larger child
+        if (child + 1 < heap->Size &&
+            heap->compare(__at(heap, child + 1), __at(heap, child)) > 0)
+            child++;
+        if (heap->compare(__at(heap, child), value) <= 0) break;
+        memcpy(__at(heap, current), __at(heap, child), heap->elementSize);
+        current = child;
+    }
+    memcpy(__at(heap, current), value, heap->elementSize);
 }
 
 void ArrayHeapPop(ArrayHeap *const restrict heap) {
     assert(heap != NULL);
     assert(heap->Size > 0);
-    unsigned int current = 0;
 
     heap->Size--;
-    while ((current * 2 + 1) < heap->Size) {
-        if (heap->compare(
-                heap->array + heap->elementSize * (current * 2 + 1),
-                heap->array + heap->elementSize * (current * 2 + 2)) >= 0) {
-            // left child is larger than or equal to right child
-            if (heap->compare(
-                    heap->array + heap->elementSize * (current * 2 + 1),
-                    heap->array + heap->elementSize * heap->Size) > 0) {
-                // less than left child
-                memcpy(heap->array + heap->elementSize * current,
-                       heap->array + heap->elementSize * (current * 2 + 1),
-                       heap->elementSize);
-                current = current * 2 + 1;
-            } else
-                break;
-        } else {
-            // left child is less than right child
-            if (heap->compare(
-                    heap->array + heap->elementSize * (current * 2 + 2),
-                    heap->array + heap->elementSize * heap->Size) > 0) {
-                // less than right child
-                memcpy(heap->array + heap->elementSize * current,
-                       heap->array + heap->elementSize * (current * 2 + 2),
-                       heap->elementSize);
-                current = current * 2 + 2;
-            } else
-                break;
-        }
+    if (heap->Size > 0) __ArrayHeapSiftDown(heap, __at(heap, heap->Size));
+    __ArrayHeapStep(heap);
+    __ArrayHeapShrink(heap);
+}
+
+void ArrayHeapPopInto(ArrayHeap *const restrict heap,
+                      void *const restrict output) {
+    assert(heap != NULL);
+    assert(output != NULL);
+    assert(heap->Size > 0);
+
+    memcpy(output, __at(heap, 0), heap->elementSize);
+    ArrayHeapPop(heap);
+}
+
+void ArrayHeapReplaceTop(ArrayHeap *const restrict heap,
+                         const void *const restrict value) {
+    assert(heap != NULL);
+    assert(value != NULL);
+    assert(heap->Size > 0);
+
+    __ArrayHeapSiftDown(heap, value);
+    __ArrayHeapStep(heap);
+}
+
+void ArrayHeapPushPop(ArrayHeap *const restrict heap,
+                      const void *const restrict value,
+                      void *const restrict output) {
+    assert(heap != NULL);
+    assert(value != NULL);
+    assert(output != NULL);
+
+    if (heap->Size == 0 || heap->compare(value, __at(heap, 0)) >= 0) {
+        memcpy(output, value, heap->elementSize);
+        return;
     }
-    memcpy(heap->array + heap->elementSize * current,
-           heap->array + heap->elementSize * heap->Size, heap->elementSize);
+    memcpy(output, __at(heap, 0), heap->elementSize);
+    __ArrayHeapSiftDown(heap, value);
+    __ArrayHeapStep(heap);
 }
 
 ArrayHeapIterator ArrayHeapGetIterator(ArrayHeap *const restrict heap) {
     assert(heap != NULL);
+    __ArrayHeapSettle(heap);
     ArrayHeapIterator iterator = {heap->array, heap->elementSize, 0,
                                   heap->Size};
     return iterator;
@@ -126,6 +341,7 @@ ArrayHeapIterator ArrayHeapGetIterator(ArrayHeap *const restrict heap) {
 
 ArrayHeapIterator ArrayHeapGetReverseIterator(ArrayHeap *const restrict heap) {
     assert(heap != NULL);
+    __ArrayHeapSettle(heap);
     ArrayHeapIterator iterator = {heap->array, heap->elementSize,
                                   heap->Size - 1, heap->Size};
     return iterator;
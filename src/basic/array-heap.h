@@ -11,8 +11,8 @@
 typedef struct {
     void *array;
     unsigned long elementSize;
-    unsigned int current;
-    unsigned int size;
+    size_t current;
+    size_t size;
 } ArrayHeapIterator;
 
 /**
@@ -42,13 +42,56 @@ typedef struct {
      */
     CompareFunction *compare;
 
+    /**
+     * @private
+     * @brief Factor by which capacity is multiplied when this heap is full.
+     * @warning Don't modify this member directly.
+     * @see `ArrayHeapSetGrowthFactor()`.
+     */
+    double growthFactor;
+    /**
+     * @private
+     * @brief Whether capacity is reduced automatically after removals.
+     * @warning Don't modify this member directly.
+     * @see `ArrayHeapSetAutoShrink()`.
+     */
+    Bool autoShrink;
+    /**
+     * @private
+     * @brief Whether growth migrates elements incrementally.
+     * @warning Don't modify this member directly.
+     * @see `ArrayHeapSetIncremental()`.
+     */
+    Bool incremental;
+    /**
+     * @private
+     * @brief Storage before the last incremental growth, or `NULL` if no
+     * migration is in progress. Elements in `[migrated, limit)` are still
+     * stored here.
+     * @warning Don't modify this member directly.
+     */
+    void *previous;
+    /**
+     * @private
+     * @brief Count of leading elements already moved out of `previous`.
+     * @warning Don't modify this member directly.
+     */
+    size_t migrated;
+    /**
+     * @private
+     * @brief End of the elements which are still to be moved out of
+     * `previous`.
+     * @warning Don't modify this member directly.
+     */
+    size_t limit;
+
     /**
      * @public
      * @brief Current element quantity of this heap.
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Size;
+    size_t Size;
     /**
      * @public
      * @brief Current element capacity of this heap. If `Size` is going to be
@@ -57,7 +100,7 @@ typedef struct {
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Capacity;
+    size_t Capacity;
 } ArrayHeap;
 
 /**
@@ -69,7 +112,7 @@ typedef struct {
  * @param compare Function used in comparing two elements.
  */
 void ArrayHeapConstruct(ArrayHeap *const restrict heap,
-                        const unsigned int initialCapacity,
+                        const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare);
 
@@ -81,7 +124,7 @@ void ArrayHeapConstruct(ArrayHeap *const restrict heap,
  * @param compare Function used in comparing two elements.
  * @return ArrayHeap* Pointer refering to a heap address.
  */
-ArrayHeap *ArrayHeapNew(const unsigned int initialCapacity,
+ArrayHeap *ArrayHeapNew(const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare);
 
@@ -100,6 +143,60 @@ void ArrayHeapDestruct(ArrayHeap *const restrict heap);
  */
 void ArrayHeapDelete(ArrayHeap **const restrict heap);
 
+/**
+ * @brief Set the factor by which capacity of `heap` is multiplied when it is
+ * full. It is `2` by default. O(1).
+ *
+ * @param heap `this`.
+ * @param factor Growth factor. It must be greater than `1`.
+ */
+void ArrayHeapSetGrowthFactor(ArrayHeap *const restrict heap,
+                              const double factor);
+
+/**
+ * @brief Enable or disable automatic shrinking of `heap`. When enabled, the
+ * capacity is reduced to `Size` times the growth factor once `Size` falls to
+ * `Capacity` divided by the square of the growth factor, so that alternating
+ * pushes and removals near the boundary don't reallocate repeatedly. It is
+ * disabled by default. O(1).
+ *
+ * @param heap `this`.
+ * @param autoShrink `TRUE` to enable.
+ */
+void ArrayHeapSetAutoShrink(ArrayHeap *const restrict heap,
+                            const Bool autoShrink);
+
+/**
+ * @brief Enable or disable incremental growth of `heap`. When enabled, a full
+ * heap allocates its new storage without copying, and then moves a bounded
+ * number of elements on each following push or removal, so that the
+ * migration is finished before the heap is full again. Pushes and removals
+ * stay O(log₂n) in the worst case, while iterators, `ArrayHeapReserve()` and
+ * `ArrayHeapShrinkToFit()` finish a pending migration first. It is disabled by
+ * default. O(1), or O(n) if disabling it finishes a migration.
+ *
+ * @param heap `this`.
+ * @param incremental `TRUE` to enable.
+ */
+void ArrayHeapSetIncremental(ArrayHeap *const restrict heap,
+                             const Bool incremental);
+
+/**
+ * @brief Make sure that `heap` can hold `capacity` elements without
+ * reallocation. O(n).
+ *
+ * @param heap `this`.
+ * @param capacity Required capacity.
+ */
+void ArrayHeapReserve(ArrayHeap *const restrict heap, const size_t capacity);
+
+/**
+ * @brief Reduce capacity of `heap` to its size, but at least `1`. O(n).
+ *
+ * @param heap `this`.
+ */
+void ArrayHeapShrinkToFit(ArrayHeap *const restrict heap);
+
 /**
  * @brief Get value of the element which is on the top of `heap`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
@@ -126,6 +223,40 @@ void ArrayHeapPush(ArrayHeap *const restrict heap,
  */
 void ArrayHeapPop(ArrayHeap *const restrict heap);
 
+/**
+ * @brief Copy the element which is on the top of `heap` into `output`, and
+ * remove it. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param output Pointer refers to memory which can hold an element.
+ */
+void ArrayHeapPopInto(ArrayHeap *const restrict heap,
+                      void *const restrict output);
+
+/**
+ * @brief Replace the element which is on the top of `heap` with `value`. It
+ * equals to `ArrayHeapPop()` followed by `ArrayHeapPush()`, but only sifts
+ * once. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void ArrayHeapReplaceTop(ArrayHeap *const restrict heap,
+                         const void *const restrict value);
+
+/**
+ * @brief Add `value` into `heap`, then remove the element which is on the top
+ * of `heap` and copy it into `output`. If `value` would be on the top, `heap`
+ * is not modified. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param value Value of element. It will be DEEP copied.
+ * @param output Pointer refers to memory which can hold an element.
+ */
+void ArrayHeapPushPop(ArrayHeap *const restrict heap,
+                      const void *const restrict value,
+                      void *const restrict output);
+
 /**
  * @brief Get iterator of `heap`. O(1).
  *
@@ -3,9 +3,21 @@
 #include <assert.h>
 #include <malloc.h>
 #include <memory.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "batch-test.h"
+
+/**
+ * @brief Step in which large lists commit memory. It is the size of a
+ * transparent huge page on x86-64 and most AArch64 systems.
+ */
+static const unsigned long __LARGE_STEP = 1UL << 21;
 
 void ArrayListConstruct(ArrayList *const restrict list,
-                        const unsigned int initialCapacity,
+                        const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare) {
     assert(list != NULL);
@@ -17,11 +29,22 @@ void ArrayListConstruct(ArrayList *const restrict list,
     assert(list->array != NULL);
     list->elementSize = elementSize;
     list->Capacity = initialCapacity;
+    list->front = 0;
     list->Size = 0;
     list->compare = compare;
+    list->growthFactor = 2;
+    list->autoShrink = FALSE;
+    list->reserved = 0;
+    list->committed = 0;
+    list->incremental = FALSE;
+    list->previous = NULL;
+    list->previousFront = 0;
+    list->migrated = 0;
+    list->limit = 0;
+    list->Sorted = FALSE;
 }
 
-ArrayList *ArrayListNew(const unsigned int initialCapacity,
+ArrayList *ArrayListNew(const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare) {
     ArrayList *list = (ArrayList *)malloc(sizeof(ArrayList));
@@ -29,13 +52,82 @@ ArrayList *ArrayListNew(const unsigned int initialCapacity,
     return list;
 }
 
+void ArrayListConstructLarge(ArrayList *const restrict list,
+                             const size_t maximumCapacity,
+                             const unsigned long elementSize,
+                             CompareFunction *const compare) {
+    assert(list != NULL);
+    assert(maximumCapacity > 0);
+    assert(elementSize > 0);
+    assert(maximumCapacity <= (SIZE_MAX - 2 * __LARGE_STEP) / elementSize);
+    assert(compare != NULL);
+
+    const unsigned long reserved =
+        (maximumCapacity * elementSize + __LARGE_STEP - 1) &
+        ~(__LARGE_STEP - 1);
+    // Over-reserve by one step and trim both ends, so the reservation starts
+    // on a huge page boundary.
+    void *const mapping =
+        mmap(NULL, reserved + __LARGE_STEP, PROT_NONE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    assert(mapping != MAP_FAILED);
+    void *const array =
+        (void *)(((unsigned long)mapping + __LARGE_STEP - 1) &
+                 ~(__LARGE_STEP - 1));
+    if (array != mapping) munmap(mapping, array - mapping);
+    munmap(array + reserved, mapping + __LARGE_STEP - array);
+#ifdef MADV_HUGEPAGE
+    madvise(array, reserved, MADV_HUGEPAGE);
+#endif
+
+    list->array = array;
+    list->elementSize = elementSize;
+    list->Capacity = 0;
+    list->front = 0;
+    list->Size = 0;
+    list->compare = compare;
+    list->growthFactor = 2;
+    list->autoShrink = FALSE;
+    list->reserved = reserved;
+    list->committed = 0;
+    list->incremental = FALSE;
+    list->previous = NULL;
+    list->previousFront = 0;
+    list->migrated = 0;
+    list->limit = 0;
+    list->Sorted = FALSE;
+}
+
+ArrayList *ArrayListNewLarge(const size_t maximumCapacity,
+                             const unsigned long elementSize,
+                             CompareFunction *const compare) {
+    ArrayList *list = (ArrayList *)malloc(sizeof(ArrayList));
+    ArrayListConstructLarge(list, maximumCapacity, elementSize, compare);
+    return list;
+}
+
 void ArrayListDestruct(ArrayList *const restrict list) {
     if (list == NULL) return;
 
-    free(list->array);
+    void *const base = list->array - list->front * list->elementSize;
+    if (list->reserved != 0) {
+        munmap(base, list->reserved);
+    } else {
+        free(base);
+    }
+    if (list->previous != NULL) {
+        free(list->previous - list->previousFront * list->elementSize);
+    }
     list->array = NULL;
+    list->reserved = 0;
+    list->committed = 0;
+    list->previous = NULL;
+    list->previousFront = 0;
+    list->migrated = 0;
+    list->limit = 0;
     list->elementSize = 0;
     list->Capacity = 0;
+    list->front = 0;
     list->Size = 0;
 }
 
@@ -47,30 +139,329 @@ void ArrayListDelete(ArrayList **const restrict list) {
     *list = NULL;
 }
 
-void *ArrayListGet(const ArrayList *const restrict list,
-                   const unsigned int index) {
+/**
+ * @brief Get element at `index`, wherever it is stored during an incremental
+ * migration. O(1).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return void* The element.
+ */
+static inline void *__at(const ArrayList *const list, const size_t index) {
+    if (index >= list->migrated && index < list->limit) {
+        return list->previous + index * list->elementSize;
+    }
+    return list->array + index * list->elementSize;
+}
+
+/**
+ * @brief Get the end of the contiguous run of elements which contains `index`
+ * during an incremental migration. Functions reading `list` through a pointer
+ * to const use it instead of finishing the migration. O(1).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return size_t Index after the last element of the run.
+ */
+static inline size_t __ArrayListRun(const ArrayList *const list,
+                                    const size_t index) {
+    size_t end = list->Size;
+    if (index >= list->migrated && index < list->limit) {
+        end = list->limit;
+    } else if (index < list->migrated && list->migrated < list->limit) {
+        end = list->migrated;
+    }
+    return end < list->Size ? end : list->Size;
+}
+
+/**
+ * @brief Move up to `count` pending elements out of `list->previous`, and
+ * release it once it is empty. O(count).
+ *
+ * @param list `this`.
+ * @param count Maximum count of moved elements.
+ */
+static void __ArrayListMigrate(ArrayList *const restrict list, size_t count) {
+    if (list->previous == NULL) return;
+    // Popped elements don't need to be moved.
+    if (list->limit > list->Size) list->limit = list->Size;
+    if (list->migrated < list->limit) {
+        if (count > list->limit - list->migrated) {
+            count = list->limit - list->migrated;
+        }
+        memcpy(list->array + list->migrated * list->elementSize,
+               list->previous + list->migrated * list->elementSize,
+               count * list->elementSize);
+        list->migrated += count;
+    }
+    if (list->migrated >= list->limit) {
+        free(list->previous - list->previousFront * list->elementSize);
+        list->previous = NULL;
+        list->previousFront = 0;
+        list->migrated = 0;
+        list->limit = 0;
+    }
+}
+
+/**
+ * @brief Move one step of pending elements, enough to finish the migration
+ * before `list` is full again. O(1).
+ *
+ * @param list `this`.
+ */
+static inline void __ArrayListStep(ArrayList *const restrict list) {
+    if (list->previous == NULL) return;
+    __ArrayListMigrate(
+        list, list->limit / (list->Capacity - list->front - list->limit) + 1);
+}
+
+/**
+ * @brief Finish a pending migration, so that all elements are contiguous in
+ * `list->array`. O(n).
+ *
+ * @param list `this`.
+ */
+static inline void __ArrayListSettle(ArrayList *const restrict list) {
+    if (list->previous != NULL) __ArrayListMigrate(list, SIZE_MAX);
+}
+
+/**
+ * @brief Move elements of `list` inside its storage, so that `front` unused
+ * slots are left before the first element. O(n).
+ *
+ * @param list `this`.
+ * @param front New count of unused slots before the first element. There
+ * must be room for `list->Size` elements after them.
+ */
+static void __ArrayListMove(ArrayList *const restrict list,
+                            const size_t front) {
+    void *const array = list->array - list->front * list->elementSize +
+                        front * list->elementSize;
+    memmove(array, list->array, list->Size * list->elementSize);
+    list->array = array;
+    list->front = front;
+}
+
+/**
+ * @brief Reallocate storage of `list` to hold exactly `capacity` elements.
+ * Large lists commit or release whole steps of their reservation instead, so
+ * their capacity is rounded up. O(n).
+ *
+ * @param list `this`.
+ * @param capacity New capacity. It must not be less than `list->Size`.
+ */
+static void __ArrayListResize(ArrayList *const restrict list,
+                              const size_t capacity) {
+    assert(capacity <= SIZE_MAX / list->elementSize);
+    __ArrayListSettle(list);
+    if (list->front != 0) __ArrayListMove(list, 0);
+    if (list->reserved != 0) {
+        const unsigned long committed =
+            (capacity * list->elementSize + __LARGE_STEP - 1) &
+            ~(__LARGE_STEP - 1);
+        assert(committed <= list->reserved);
+        if (committed > list->committed) {
+            const int result =
+                mprotect(list->array + list->committed,
+                         committed - list->committed, PROT_READ | PROT_WRITE);
+            assert(result == 0);
+            (void)result;
+        } else if (committed < list->committed) {
+            // Drop the pages first, so they are not kept while inaccessible.
+            madvise(list->array + committed, list->committed - committed,
+                    MADV_DONTNEED);
+            mprotect(list->array + committed, list->committed - committed,
+                     PROT_NONE);
+        }
+        list->committed = committed;
+        list->Capacity = committed / list->elementSize;
+        return;
+    }
+    void *temp = realloc(list->array, capacity * list->elementSize);
+    assert(temp != NULL);
+    list->array = temp;
+    list->Capacity = capacity;
+}
+
+/**
+ * @brief Get the capacity which `list` grows to for holding `size` elements,
+ * multiplying its capacity by the growth factor as many times as needed, but
+ * at least once. O(1).
+ *
+ * @param list `this`.
+ * @param size Required capacity.
+ * @return size_t New capacity.
+ */
+static size_t __ArrayListNextCapacity(const ArrayList *const restrict list,
+                                      const size_t size) {
+    // Growth stops at the reservation of a large list, or at the largest
+    // capacity whose byte size can be represented.
+    const size_t maximum = list->reserved != 0
+                               ? list->reserved / list->elementSize
+                               : SIZE_MAX / list->elementSize;
+    assert(size <= maximum);
+    size_t capacity = list->Capacity;
+    do {
+        const double next = capacity * list->growthFactor;
+        if (next >= maximum) {
+            capacity = maximum;
+        } else {
+            capacity = next >= capacity + 1 ? next : capacity + 1;
+        }
+    } while (capacity < size);
+    return capacity;
+}
+
+/**
+ * @brief Make sure that `size` elements fit after the unused slots before the
+ * first element of `list`. If at most half of the storage would be used, the
+ * elements are moved to its beginning instead of growing it, which is paid
+ * for by the removals at the front that left those slots unused. Amortized
+ * O(1).
+ *
+ * @param list `this`.
+ * @param size Required capacity.
+ */
+static void __ArrayListReserve(ArrayList *const restrict list,
+                               const size_t size) {
+    if (list->front + size <= list->Capacity) return;
+    if (size <= list->Capacity / 2) {
+        __ArrayListSettle(list);
+        __ArrayListMove(list, 0);
+        return;
+    }
+    __ArrayListResize(list, __ArrayListNextCapacity(list, size));
+}
+
+/**
+ * @brief Make sure that there are `count` unused slots before the first
+ * element of `list`. The elements are placed in the middle of the free
+ * space, so that following insertions at both ends are cheap. Amortized
+ * O(1).
+ *
+ * @param list `this`.
+ * @param count Required count of unused slots.
+ */
+static void __ArrayListReserveFront(ArrayList *const restrict list,
+                                    const size_t count) {
+    if (list->front >= count) return;
+    const size_t size = list->Size + count;
+    if (size > list->Capacity / 2) {
+        __ArrayListResize(list, __ArrayListNextCapacity(list, size));
+    }
+    __ArrayListMove(list, count + (list->Capacity - size) / 2);
+}
+
+/**
+ * @brief Make room for one more element of a full `list`. In incremental mode,
+ * new storage is allocated without copying, and pending elements are moved
+ * by the following operations. O(1) in incremental mode, O(n) otherwise.
+ *
+ * @param list `this`.
+ */
+static void __ArrayListGrow(ArrayList *const restrict list) {
+    if (list->front + list->Size < list->Capacity) return;
+    if (!list->incremental || list->reserved != 0 || list->Size == 0) {
+        __ArrayListReserve(list, list->Size + 1);
+        return;
+    }
+    // The previous migration is always finished before the list fills up
+    // again, unless the growth factor was changed in between.
+    __ArrayListSettle(list);
+    // New capacity follows the size rather than the old capacity, so unused
+    // slots before the first element are not carried over.
+    const size_t maximum = SIZE_MAX / list->elementSize;
+    assert(list->Size < maximum);
+    const double next = list->Size * list->growthFactor;
+    size_t capacity = next >= maximum ? maximum : next;
+    if (capacity <= list->Size) capacity = list->Size + 1;
+    void *temp = malloc(capacity * list->elementSize);
+    assert(temp != NULL);
+    list->previous = list->array;
+    list->previousFront = list->front;
+    list->array = temp;
+    list->front = 0;
+    list->migrated = 0;
+    list->limit = list->Size;
+    list->Capacity = capacity;
+}
+
+/**
+ * @brief Reduce capacity of `list` after removals if automatic shrinking is
+ * enabled and `list` is sparse enough. O(n) when shrinking, O(1) otherwise.
+ *
+ * @param list `this`.
+ */
+static void __ArrayListShrink(ArrayList *const restrict list) {
+    if (!list->autoShrink) return;
+    const double factor = list->growthFactor;
+    if (list->Size * factor * factor > list->Capacity) return;
+    const double target = list->Size * factor;
+    const size_t capacity = target < 1 ? 1 : target;
+    if (capacity < list->Capacity) __ArrayListResize(list, capacity);
+}
+
+void ArrayListSetGrowthFactor(ArrayList *const restrict list,
+                              const double factor) {
+    assert(list != NULL);
+    assert(factor > 1);
+    list->growthFactor = factor;
+}
+
+void ArrayListSetAutoShrink(ArrayList *const restrict list,
+                            const Bool autoShrink) {
+    assert(list != NULL);
+    list->autoShrink = autoShrink;
+}
+
+void ArrayListSetIncremental(ArrayList *const restrict list,
+                             const Bool incremental) {
+    assert(list != NULL);
+    list->incremental = incremental;
+    if (!incremental) __ArrayListSettle(list);
+}
+
+void ArrayListReserve(ArrayList *const restrict list, const size_t capacity) {
+    assert(list != NULL);
+    if (list->front + capacity > list->Capacity) {
+        __ArrayListResize(
+            list, capacity > list->Capacity ? capacity : list->Capacity);
+    }
+}
+
+void ArrayListShrinkToFit(ArrayList *const restrict list) {
+    assert(list != NULL);
+    const size_t capacity = list->Size > 0 ? list->Size : 1;
+    if (capacity != list->Capacity) __ArrayListResize(list, capacity);
+}
+
+void *ArrayListGet(const ArrayList *const restrict list, const size_t index) {
     assert(list != NULL);
     assert(index < list->Size);
-    return list->array + index * list->elementSize;
+    return __at(list, index);
 }
 
-void ArrayListSet(ArrayList *const restrict list, const unsigned int index,
+void ArrayListSet(ArrayList *const restrict list, const size_t index,
                   const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
     assert(index < list->Size);
-    memcpy(list->array + index * list->elementSize, value, list->elementSize);
+    list->Sorted = FALSE;
+    memcpy(__at(list, index), value, list->elementSize);
+    __ArrayListStep(list);
 }
 
 void *ArrayListBack(const ArrayList *const restrict list) {
     assert(list != NULL);
     if (list->Size == 0) return NULL;
-    return list->array + list->elementSize * (list->Size - 1);
+    return __at(list, list->Size - 1);
 }
 
-void *ArrayListFront(const ArrayList *const restrict list) {
+void *ArrayListFront(ArrayList *const restrict list) {
     assert(list != NULL);
     if (list->Size == 0) return NULL;
+    // Callers may scan the whole list from the front element.
+    __ArrayListSettle(list);
     return list->array;
 }
 
@@ -78,45 +469,33 @@ void ArrayListPushBack(ArrayList *const restrict list,
                        const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
-    void *temp = NULL;
 
-    if (list->Size == list->Capacity) {
-        list->Capacity *= 2;
-        temp = calloc(list->Capacity, list->elementSize);
-        assert(temp != NULL);
-        memcpy(temp, list->array, list->Size * list->elementSize);
-        free(list->array);
-        list->array = temp;
-    }
+    __ArrayListGrow(list);
+    list->Sorted = FALSE;
     memcpy(list->array + list->Size * list->elementSize, value,
            list->elementSize);
     list->Size++;
+    __ArrayListStep(list);
 }
 
 void ArrayListPopBack(ArrayList *const restrict list) {
     assert(list != NULL);
     assert(list->Size > 0);
     list->Size--;
+    __ArrayListStep(list);
+    __ArrayListShrink(list);
 }
 
 void ArrayListPushFront(ArrayList *const restrict list,
                         const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
-    void *temp = NULL;
-
-    if (list->Size == list->Capacity) {
-        list->Capacity *= 2;
-        temp = calloc(list->Capacity, list->elementSize);
-        assert(temp != NULL);
-        memcpy(temp + list->elementSize, list->array,
-               list->Size * list->elementSize);
-        free(list->array);
-        list->array = temp;
-    } else {
-        memmove(list->array + list->elementSize, list->array,
-                list->Size * list->elementSize);
-    }
+    __ArrayListSettle(list);
+
+    list->Sorted = FALSE;
+    __ArrayListReserveFront(list, 1);
+    list->array -= list->elementSize;
+    list->front--;
     memcpy(list->array, value, list->elementSize);
     list->Size++;
 }
@@ -124,31 +503,30 @@ void ArrayListPushFront(ArrayList *const restrict list,
 void ArrayListPopFront(ArrayList *const restrict list) {
     assert(list != NULL);
     assert(list->Size > 0);
+    __ArrayListSettle(list);
+    list->array += list->elementSize;
+    list->front++;
     list->Size--;
-    memmove(list->array, list->array + list->elementSize,
-            list->elementSize * list->Size);
+    __ArrayListShrink(list);
 }
 
-void ArrayListInsert(ArrayList *const restrict list, const unsigned int index,
+void ArrayListInsert(ArrayList *const restrict list, const size_t index,
                      const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
     assert(index <= list->Size);
-    void *temp = NULL;
-
-    if (list->Size == list->Capacity) {
-        if (list->Size == list->Capacity) {
-            list->Capacity *= 2;
-            temp = calloc(list->Capacity, list->elementSize);
-            assert(temp != NULL);
-            memcpy(temp, list->array, index * list->elementSize);
-            memcpy(temp + list->elementSize * (index + 1),
-                   list->array + list->elementSize * index,
-                   list->elementSize * (list->Size - index));
-            free(list->array);
-            list->array = temp;
-        }
+    __ArrayListSettle(list);
+
+    list->Sorted = FALSE;
+    // Elements on the shorter side of `index` are shifted.
+    if (index < list->Size - index) {
+        __ArrayListReserveFront(list, 1);
+        list->array -= list->elementSize;
+        list->front--;
+        memmove(list->array, list->array + list->elementSize,
+                list->elementSize * index);
     } else {
+        __ArrayListReserve(list, list->Size + 1);
         memmove(list->array + list->elementSize * (index + 1),
                 list->array + list->elementSize * index,
                 list->elementSize * (list->Size - index));
@@ -157,28 +535,224 @@ void ArrayListInsert(ArrayList *const restrict list, const unsigned int index,
     list->Size++;
 }
 
-int ArrayListFind(const ArrayList *const restrict list,
-                  const void *const restrict value) {
+void ArrayListInsertRange(ArrayList *const restrict list, const size_t index,
+                          const void *const restrict values,
+                          const size_t count) {
+    assert(list != NULL);
+    assert(values != NULL || count == 0);
+    assert(index <= list->Size);
+    if (count == 0) return;
+    __ArrayListSettle(list);
+
+    list->Sorted = FALSE;
+    if (index < list->Size - index) {
+        __ArrayListReserveFront(list, count);
+        list->array -= count * list->elementSize;
+        list->front -= count;
+        memmove(list->array, list->array + count * list->elementSize,
+                index * list->elementSize);
+    } else {
+        __ArrayListReserve(list, list->Size + count);
+        memmove(list->array + (index + count) * list->elementSize,
+                list->array + index * list->elementSize,
+                (list->Size - index) * list->elementSize);
+    }
+    memcpy(list->array + index * list->elementSize, values,
+           count * list->elementSize);
+    list->Size += count;
+}
+
+void ArrayListErase(ArrayList *const restrict list, const size_t index,
+                    const size_t count) {
+    assert(list != NULL);
+    assert(index <= list->Size && count <= list->Size - index);
+    __ArrayListSettle(list);
+    if (index < list->Size - index - count) {
+        memmove(list->array + count * list->elementSize, list->array,
+                index * list->elementSize);
+        list->array += count * list->elementSize;
+        list->front += count;
+    } else {
+        memmove(list->array + index * list->elementSize,
+                list->array + (index + count) * list->elementSize,
+                (list->Size - index - count) * list->elementSize);
+    }
+    list->Size -= count;
+    __ArrayListShrink(list);
+}
+
+size_t ArrayListRemoveIf(ArrayList *const restrict list,
+                         TestFunction *const test) {
+    assert(list != NULL);
+    assert(test != NULL);
+    __ArrayListSettle(list);
+    // Kept elements are moved run by run, so each one is copied at most once.
+    size_t kept = 0, i = 0;
+    while (i < list->Size) {
+        while (i < list->Size &&
+               test(list->array + i * list->elementSize) == TRUE) {
+            i++;
+        }
+        const size_t start = i;
+        while (i < list->Size &&
+               test(list->array + i * list->elementSize) != TRUE) {
+            i++;
+        }
+        if (start != kept) {
+            memmove(list->array + kept * list->elementSize,
+                    list->array + start * list->elementSize,
+                    (i - start) * list->elementSize);
+        }
+        kept += i - start;
+    }
+    const size_t removed = list->Size - kept;
+    list->Size = kept;
+    __ArrayListShrink(list);
+    return removed;
+}
+
+/**
+ * @brief Branchless binary search over `size` ascending elements from
+ * `array`. O(log₂n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @param value Specified value.
+ * @param upper If `TRUE`, elements equal to `value` are skipped.
+ * @return size_t Index of the first element greater than `value`, or
+ * not less than `value` if `upper` is `FALSE`.
+ */
+static size_t __bound(const void *const restrict array, size_t size,
+                      const unsigned long elementSize,
+                      CompareFunction *const compare,
+                      const void *const restrict value, const Bool upper) {
+    if (size == 0) return 0;
+    const int limit = upper ? 0 : -1;
+    size_t base = 0;
+    // The answer stays within [base, base + size]. The conditional move keeps
+    // the loop free of unpredictable branches.
+    while (size > 1) {
+        const size_t half = size / 2;
+        base = compare(array + (base + half) * elementSize, value) <= limit
+                   ? base + half
+                   : base;
+        size -= half;
+    }
+    return base + (compare(array + base * elementSize, value) <= limit);
+}
+
+/**
+ * @brief Binary search in `list` while an incremental migration is pending,
+ * reading every element through `__at()`. O(log₂n).
+ *
+ * @param list `this`.
+ * @param value Specified value.
+ * @param upper If `TRUE`, elements equal to `value` are skipped.
+ * @return size_t Index of the first element greater than `value`, or
+ * not less than `value` if `upper` is `FALSE`.
+ */
+static size_t __ArrayListBound(const ArrayList *const restrict list,
+                               const void *const restrict value,
+                               const Bool upper) {
+    if (list->previous == NULL) {
+        return __bound(list->array, list->Size, list->elementSize,
+                       list->compare, value, upper);
+    }
+    const int limit = upper ? 0 : -1;
+    size_t base = 0, size = list->Size;
+    while (size > 0) {
+        const size_t half = size / 2;
+        if (list->compare(__at(list, base + half), value) <= limit) {
+            base += half + 1;
+            size -= half + 1;
+        } else {
+            size = half;
+        }
+    }
+    return base;
+}
+
+size_t ArrayListFind(const ArrayList *const restrict list,
+                     const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
-    for (unsigned int i = 0; i < list->Size; i++) {
-        if (list->compare(list->array + list->elementSize * i, value) == 0)
-            return i;
+    if (list->Sorted) {
+        const size_t index = __ArrayListBound(list, value, FALSE);
+        return index < list->Size &&
+                       list->compare(__at(list, index), value) == 0
+                   ? index
+                   : (size_t)-1;
+    }
+    for (size_t i = 0; i < list->Size; i++) {
+        if (list->compare(__at(list, i), value) == 0) return i;
     }
     return -1;
 }
 
+size_t ArrayListLowerBound(const ArrayList *const restrict list,
+                           const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    assert(list->Sorted || list->Size < 2);
+    return __ArrayListBound(list, value, FALSE);
+}
+
+size_t ArrayListUpperBound(const ArrayList *const restrict list,
+                           const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    assert(list->Sorted || list->Size < 2);
+    return __ArrayListBound(list, value, TRUE);
+}
+
+size_t ArrayListInsertSorted(ArrayList *const restrict list,
+                             const void *const restrict value) {
+    const size_t index = ArrayListUpperBound(list, value);
+    ArrayListInsert(list, index, value);
+    list->Sorted = TRUE;
+    return index;
+}
+
 ArrayList *ArrayListSlice(const ArrayList *const restrict list,
-                          const unsigned int start, const unsigned int size) {
+                          const size_t start, const size_t size) {
     assert(list != NULL);
     assert(start < list->Size);
     assert(size > 0);
     ArrayList *slice = ArrayListNew(size, list->elementSize, list->compare);
-    memcpy(slice->array, list->array + list->elementSize * start,
-           list->elementSize * size);
+    for (size_t i = start, end = 0; i < start + size; i = end) {
+        end = __ArrayListRun(list, i);
+        if (end > start + size) end = start + size;
+        memcpy(slice->array + (i - start) * list->elementSize, __at(list, i),
+               (end - i) * list->elementSize);
+    }
     return slice;
 }
 
+ArrayList *ArrayListFilter(const ArrayList *const restrict list,
+                           BatchTestFunction *const test) {
+    assert(list != NULL);
+    assert(test != NULL);
+    ArrayList *result = ArrayListNew(list->Size > 0 ? list->Size : 1,
+                                     list->elementSize, list->compare);
+    // Batches never cross the end of a run, so each one is contiguous.
+    for (size_t i = 0, count = 0; i < list->Size; i += count) {
+        const size_t end = __ArrayListRun(list, i);
+        count = end - i < 64 ? end - i : 64;
+        const void *const values = __at(list, i);
+        unsigned long long mask = test(values, count) & __BatchTestMask(count);
+        while (mask != 0) {
+            memcpy(result->array + result->Size * result->elementSize,
+                   values + __builtin_ctzll(mask) * list->elementSize,
+                   list->elementSize);
+            result->Size++;
+            mask &= mask - 1;
+        }
+    }
+    return result;
+}
+
 /**
  * @brief Swap values of two specified elements. O(1).
  *
@@ -196,52 +770,695 @@ static inline void __swap(void *const restrict a, void *const restrict b,
 }
 
 /**
- * @brief Quick sort algorithm. Sort `list` from index `left`(contained) to
- * index `right`(contained). O(log₂n).
+ * @brief Insertion sort algorithm. Sort `size` elements from `array`. Used
+ * for short ranges where it beats partitioning. O(n²).
  *
- * @param list List to be sorted.
- * @param left Start index.
- * @param right End index.
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param elementSize Element size.
+ * @param compare Compare function.
  * @param cache Pointer refers to cache.
  */
-static void __QuickSort(ArrayList *const restrict list, const unsigned int left,
-                        const unsigned int right, void *cache) {
-    unsigned int pivot = (left + right) / 2, i = left, j = right;
-    while (i < j) {
-        while (i < pivot &&
-               list->compare(list->array + i * list->elementSize,
-                             list->array + pivot * list->elementSize) <= 0) {
-            i++;
+static void __InsertionSort(void *const restrict array, const size_t size,
+                            const unsigned long elementSize,
+                            CompareFunction *const compare,
+                            void *const restrict cache) {
+    for (size_t i = 1; i < size; i++) {
+        if (compare(array + (i - 1) * elementSize, array + i * elementSize) <=
+            0) {
+            continue;
         }
-        __swap(list->array + i * list->elementSize,
-               list->array + pivot * list->elementSize, cache,
-               list->elementSize);
-        pivot = i;
-        while (pivot < j &&
-               list->compare(list->array + j * list->elementSize,
-                             list->array + pivot * list->elementSize) > 0) {
+        memcpy(cache, array + i * elementSize, elementSize);
+        size_t j = i;
+        do {
+            memcpy(array + j * elementSize, array + (j - 1) * elementSize,
+                   elementSize);
             j--;
+        } while (j > 0 && compare(array + (j - 1) * elementSize, cache) > 0);
+        memcpy(array + j * elementSize, cache, elementSize);
+    }
+}
+
+/**
+ * @brief Sift element at index `index` down within the first `size`
+ * elements of max-heap `array`. O(log₂n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param index Index of element to be sifted.
+ * @param size Heap size.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @param cache Pointer refers to cache.
+ */
+static void __HeapSiftDown(void *const restrict array, size_t index,
+                           const size_t size, const unsigned long elementSize,
+                           CompareFunction *const compare,
+                           void *const restrict cache) {
+    memcpy(cache, array + index * elementSize, elementSize);
+    size_t child = index * 2 + 1;
+    while (child < size) {
+        if (child + 1 < size && compare(array + (child + 1) * elementSize,
+                                        array + child * elementSize) > 0) {
+            child++;
         }
-        __swap(list->array + j * list->elementSize,
-               list->array + pivot * list->elementSize, cache,
-               list->elementSize);
-        pivot = j;
+        if (compare(array + child * elementSize, cache) <= 0) break;
+        memcpy(array + index * elementSize, array + child * elementSize,
+               elementSize);
+        index = child;
+        child = index * 2 + 1;
+    }
+    memcpy(array + index * elementSize, cache, elementSize);
+}
+
+/**
+ * @brief Heap sort algorithm. Sort `size` elements from `array`. Used as
+ * the fallback of introsort. O(nlog₂n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @param cache Pointer refers to cache.
+ */
+static void __HeapSort(void *const restrict array, const size_t size,
+                       const unsigned long elementSize,
+                       CompareFunction *const compare,
+                       void *const restrict cache) {
+    for (size_t i = size / 2; i > 0; i--) {
+        __HeapSiftDown(array, i - 1, size, elementSize, compare, cache);
     }
+    for (size_t end = size - 1; end > 0; end--) {
+        __swap(array, array + end * elementSize, cache, elementSize);
+        __HeapSiftDown(array, 0, end, elementSize, compare, cache);
+    }
+}
+
+/**
+ * @brief Get index of the median among elements at `a`, `b` and `c`. O(1).
+ *
+ * @param array Pointer refers to the first element.
+ * @param a Index of the first element.
+ * @param b Index of the second element.
+ * @param c Index of the third element.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @return size_t Index of the median.
+ */
+static inline size_t __median(const void *const restrict array, const size_t a,
+                              const size_t b, const size_t c,
+                              const unsigned long elementSize,
+                              CompareFunction *const compare) {
+    const void *x = array + a * elementSize, *y = array + b * elementSize,
+               *z = array + c * elementSize;
+    if (compare(x, y) < 0) {
+        if (compare(y, z) < 0) return b;
+        return compare(x, z) < 0 ? c : a;
+    }
+    if (compare(x, z) < 0) return a;
+    return compare(y, z) < 0 ? c : b;
+}
+
+/**
+ * @brief Swap `count` elements starting at `a` with `count` elements
+ * starting at `b`. Ranges must not overlap. O(n).
+ *
+ * @param a Pointer refers to one range.
+ * @param b Pointer refers to the other range.
+ * @param count Element count.
+ * @param cache Pointer refers to cache.
+ * @param elementSize Element size.
+ */
+static inline void __swapRange(void *const restrict a, void *const restrict b,
+                               const size_t count, void *const restrict cache,
+                               const unsigned long elementSize) {
+    for (size_t i = 0; i < count; i++) {
+        __swap(a + i * elementSize, b + i * elementSize, cache, elementSize);
+    }
+}
+
+/**
+ * @brief Introsort algorithm. Sort `size` elements from `array`.
+ *
+ * Quick sort with median-of-three (ninther for large ranges) pivots and
+ * three-way partitioning, so runs of equal elements are settled in one pass.
+ * Short ranges fall through to insertion sort; once `depth` is exhausted the
+ * range is finished by heap sort, bounding the worst case. O(nlog₂n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @param cache Pointer refers to cache.
+ * @param depth Remaining partition depth before falling back to heap sort.
+ */
+static void __IntroSort(void *restrict array, size_t size,
+                        const unsigned long elementSize,
+                        CompareFunction *const compare,
+                        void *const restrict cache, unsigned int depth) {
+    while (size > 16) {
+        if (depth == 0) {
+            __HeapSort(array, size, elementSize, compare, cache);
+            return;
+        }
+        depth--;
+
+        size_t pivot;
+        if (size > 128) {
+            const size_t step = size / 8, middle = size / 2,
+                         last = size - 1;
+            pivot = __median(
+                array,
+                __median(array, 0, step, step * 2, elementSize, compare),
+                __median(array, middle - step, middle, middle + step,
+                         elementSize, compare),
+                __median(array, last - step * 2, last - step, last,
+                         elementSize, compare),
+                elementSize, compare);
+        } else {
+            pivot = __median(array, 0, size / 2, size - 1, elementSize,
+                             compare);
+        }
+        if (pivot != 0) {
+            __swap(array, array + pivot * elementSize, cache, elementSize);
+        }
 
-    if (pivot != left) __QuickSort(list, left, pivot - 1, cache);
-    if (pivot != right) __QuickSort(list, pivot + 1, right, cache);
+        // Bentley-McIlroy partition. Elements equal to the pivot are parked
+        // at both ends and swapped into the middle afterwards.
+        size_t a = 1, b = 1, c = size - 1, d = size - 1;
+        while (1) {
+            int result;
+            while (b <= c &&
+                   (result = compare(array + b * elementSize, array)) <= 0) {
+                if (result == 0) {
+                    __swap(array + a * elementSize, array + b * elementSize,
+                           cache, elementSize);
+                    a++;
+                }
+                b++;
+            }
+            while (b <= c &&
+                   (result = compare(array + c * elementSize, array)) >= 0) {
+                if (result == 0) {
+                    __swap(array + c * elementSize, array + d * elementSize,
+                           cache, elementSize);
+                    d--;
+                }
+                c--;
+            }
+            if (b > c) break;
+            __swap(array + b * elementSize, array + c * elementSize, cache,
+                   elementSize);
+            b++;
+            c--;
+        }
+
+        size_t count = a < b - a ? a : b - a;
+        __swapRange(array, array + (b - count) * elementSize, count, cache,
+                    elementSize);
+        count = d - c < size - 1 - d ? d - c : size - 1 - d;
+        __swapRange(array + b * elementSize,
+                    array + (size - count) * elementSize, count, cache,
+                    elementSize);
+
+        // Recurse into the smaller side and loop on the larger one, keeping
+        // stack depth logarithmic.
+        const size_t less = b - a, greater = d - c;
+        void *const right = array + (size - greater) * elementSize;
+        if (less < greater) {
+            __IntroSort(array, less, elementSize, compare, cache, depth);
+            array = right;
+            size = greater;
+        } else {
+            __IntroSort(right, greater, elementSize, compare, cache, depth);
+            size = less;
+        }
+    }
+    __InsertionSort(array, size, elementSize, compare, cache);
 }
 
 void ArrayListQuickSort(ArrayList *const restrict list) {
     assert(list != NULL);
+    __ArrayListSettle(list);
+    list->Sorted = TRUE;
+    if (list->Size < 2) return;
     void *cache = malloc(list->elementSize);
     assert(cache != NULL);
-    __QuickSort(list, 0, list->Size - 1, cache);
+    unsigned int depth = 0;
+    for (size_t size = list->Size; size > 1; size >>= 1) depth += 2;
+    __IntroSort(list->array, list->Size, list->elementSize, list->compare,
+                cache, depth);
     free(cache);
 }
 
+/**
+ * @brief Stable merge of two sorted ranges into `output`. Elements of `left`
+ * win ties. Ranges must not overlap `output`. O(n).
+ *
+ * @param left Pointer refers to the first element of the left range.
+ * @param leftSize Element count of the left range.
+ * @param right Pointer refers to the first element of the right range.
+ * @param rightSize Element count of the right range.
+ * @param output Pointer refers to the destination.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ */
+static void __merge(const void *restrict left, size_t leftSize,
+                    const void *restrict right, size_t rightSize,
+                    void *restrict output, const unsigned long elementSize,
+                    CompareFunction *const compare) {
+    while (leftSize > 0 && rightSize > 0) {
+        if (compare(right, left) < 0) {
+            memcpy(output, right, elementSize);
+            right += elementSize;
+            rightSize--;
+        } else {
+            memcpy(output, left, elementSize);
+            left += elementSize;
+            leftSize--;
+        }
+        output += elementSize;
+    }
+    memcpy(output, left, leftSize * elementSize);
+    memcpy(output + leftSize * elementSize, right, rightSize * elementSize);
+}
+
+/**
+ * @brief Count how many of the first `rank` merged elements of `left` and
+ * `right` come from `left`, using the tie rule of `__merge`. O(log₂n).
+ *
+ * @param rank Output position.
+ * @param left Pointer refers to the first element of the left range.
+ * @param leftSize Element count of the left range.
+ * @param right Pointer refers to the first element of the right range.
+ * @param rightSize Element count of the right range.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @return size_t Element count taken from `left`.
+ */
+static size_t __corank(const size_t rank, const void *const restrict left,
+                       const size_t leftSize, const void *const restrict right,
+                       const size_t rightSize, const unsigned long elementSize,
+                       CompareFunction *const compare) {
+    size_t low = rank > rightSize ? rank - rightSize : 0,
+           high = rank < leftSize ? rank : leftSize;
+    while (low < high) {
+        const size_t i = low + (high - low) / 2, j = rank - i;
+        if (compare(left + i * elementSize, right + (j - 1) * elementSize) <=
+            0) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Bottom-up merge sort algorithm. Sort `size` elements from `array`,
+ * keeping the order of equal elements. O(nlog₂n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param scratch Pointer refers to a buffer of at least `size` elements.
+ * @param size Element count.
+ * @param elementSize Element size.
+ * @param compare Compare function.
+ * @param cache Pointer refers to cache.
+ */
+static void __MergeSort(void *const restrict array,
+                        void *const restrict scratch, const size_t size,
+                        const unsigned long elementSize,
+                        CompareFunction *const compare,
+                        void *const restrict cache) {
+    for (unsigned long start = 0; start < size; start += 16) {
+        __InsertionSort(array + start * elementSize,
+                        size - start < 16 ? size - start : 16, elementSize,
+                        compare, cache);
+    }
+    void *from = array, *to = scratch;
+    for (unsigned long width = 16; width < size; width *= 2) {
+        for (unsigned long start = 0; start < size; start += width * 2) {
+            const unsigned long middle =
+                                    start + width < size ? start + width : size,
+                                end = start + width * 2 < size
+                                          ? start + width * 2
+                                          : size;
+            __merge(from + start * elementSize, middle - start,
+                    from + middle * elementSize, end - middle,
+                    to + start * elementSize, elementSize, compare);
+        }
+        void *temp = from;
+        from = to;
+        to = temp;
+    }
+    if (from != array) memcpy(array, from, size * elementSize);
+}
+
+/**
+ * @private
+ * @brief Work item of the first phase of `ArrayListParallelSort`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Pointer refers to the first element of the run.
+     */
+    void *array;
+    /**
+     * @private
+     * @brief Pointer refers to the scratch space of the run.
+     */
+    void *scratch;
+    /**
+     * @private
+     * @brief Element count of the run.
+     */
+    size_t size;
+    /**
+     * @private
+     * @brief Element size.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Compare function.
+     */
+    CompareFunction *compare;
+    /**
+     * @private
+     * @brief Whether equal elements keep their order.
+     */
+    Bool stable;
+} __SortTask;
+
+/**
+ * @private
+ * @brief Work item of the merge phase of `ArrayListParallelSort`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Pointer refers to the first element of the left range.
+     */
+    const void *left;
+    /**
+     * @private
+     * @brief Pointer refers to the first element of the right range.
+     */
+    const void *right;
+    /**
+     * @private
+     * @brief Pointer refers to the destination.
+     */
+    void *output;
+    /**
+     * @private
+     * @brief Element count of the left range.
+     */
+    size_t leftSize;
+    /**
+     * @private
+     * @brief Element count of the right range.
+     */
+    size_t rightSize;
+    /**
+     * @private
+     * @brief Element size.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Compare function.
+     */
+    CompareFunction *compare;
+} __MergeTask;
+
+static void *__SortWorker(void *const argument) {
+    __SortTask *task = (__SortTask *)argument;
+    void *cache = malloc(task->elementSize);
+    assert(cache != NULL);
+    if (task->stable) {
+        __MergeSort(task->array, task->scratch, task->size, task->elementSize,
+                    task->compare, cache);
+    } else {
+        unsigned int depth = 0;
+        for (size_t size = task->size; size > 1; size >>= 1) depth += 2;
+        __IntroSort(task->array, task->size, task->elementSize, task->compare,
+                    cache, depth);
+    }
+    free(cache);
+    return NULL;
+}
+
+static void *__MergeWorker(void *const argument) {
+    __MergeTask *task = (__MergeTask *)argument;
+    __merge(task->left, task->leftSize, task->right, task->rightSize,
+            task->output, task->elementSize, task->compare);
+    return NULL;
+}
+
+/**
+ * @brief Run `count` tasks, the first one on the calling thread and the rest
+ * on new threads. Tasks whose thread cannot be created run on the calling
+ * thread instead.
+ *
+ * @param worker Thread routine.
+ * @param tasks Pointer refers to the first task.
+ * @param count Task count.
+ * @param taskSize Size of one task.
+ * @param threads Pointer refers to at least `count` thread handles.
+ */
+static void __ParallelRun(void *(*const worker)(void *), void *const tasks,
+                          const size_t count, const unsigned long taskSize,
+                          pthread_t *const restrict threads) {
+    size_t started = 1;
+    while (started < count && pthread_create(&threads[started], NULL, worker,
+                                             tasks + started * taskSize) == 0) {
+        started++;
+    }
+    for (size_t i = started; i < count; i++) worker(tasks + i * taskSize);
+    worker(tasks);
+    for (size_t i = 1; i < started; i++) pthread_join(threads[i], NULL);
+}
+
+void ArrayListParallelSort(ArrayList *const restrict list, unsigned int threads,
+                           const Bool stable) {
+    assert(list != NULL);
+    __ArrayListSettle(list);
+    list->Sorted = TRUE;
+    if (threads == 0) {
+        const long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? online : 1;
+    }
+    if (list->Size < 2) return;
+
+    const unsigned long elementSize = list->elementSize;
+    size_t runs = list->Size / 8192 < threads ? list->Size / 8192 : threads;
+    if (runs < 2) {
+        void *cache = malloc(elementSize);
+        assert(cache != NULL);
+        if (stable) {
+            void *scratch = malloc(list->Size * elementSize);
+            assert(scratch != NULL);
+            __MergeSort(list->array, scratch, list->Size, elementSize,
+                        list->compare, cache);
+            free(scratch);
+        } else {
+            unsigned int depth = 0;
+            for (size_t size = list->Size; size > 1; size >>= 1) {
+                depth += 2;
+            }
+            __IntroSort(list->array, list->Size, elementSize, list->compare,
+                        cache, depth);
+        }
+        free(cache);
+        return;
+    }
+
+    void *scratch = malloc(list->Size * elementSize);
+    size_t *bounds = malloc((runs + 1) * sizeof(size_t));
+    pthread_t *handles = malloc(threads * sizeof(pthread_t));
+    __SortTask *sorts = malloc(runs * sizeof(__SortTask));
+    __MergeTask *merges = malloc(threads * sizeof(__MergeTask));
+    assert(scratch != NULL && bounds != NULL && handles != NULL);
+    assert(sorts != NULL && merges != NULL);
+
+    // Sort `runs` contiguous runs independently.
+    for (size_t i = 0; i <= runs; i++) {
+        bounds[i] = list->Size * i / runs;
+    }
+    for (size_t i = 0; i < runs; i++) {
+        __SortTask task = {list->array + bounds[i] * elementSize,
+                           scratch + bounds[i] * elementSize,
+                           bounds[i + 1] - bounds[i],
+                           elementSize,
+                           list->compare,
+                           stable};
+        sorts[i] = task;
+    }
+    __ParallelRun(__SortWorker, sorts, runs, sizeof(__SortTask), handles);
+
+    // Merge runs pairwise, splitting each merge into output slices of equal
+    // length so every round keeps all threads busy.
+    void *from = list->array, *to = scratch;
+    while (runs > 1) {
+        const size_t pairs = runs / 2,
+                     slices = threads / pairs > 0 ? threads / pairs : 1;
+        size_t count = 0;
+        for (size_t pair = 0; pair < pairs; pair++) {
+            const size_t start = bounds[pair * 2],
+                         leftSize = bounds[pair * 2 + 1] - start,
+                         rightSize =
+                             bounds[pair * 2 + 2] - bounds[pair * 2 + 1],
+                         total = leftSize + rightSize;
+            const void *left = from + start * elementSize,
+                       *right = left + leftSize * elementSize;
+            size_t rank = 0, taken = 0;
+            for (size_t slice = 1; slice <= slices; slice++) {
+                const size_t nextRank = total * slice / slices,
+                             nextTaken = __corank(nextRank, left, leftSize,
+                                                  right, rightSize, elementSize,
+                                                  list->compare);
+                __MergeTask task = {left + taken * elementSize,
+                                    right + (rank - taken) * elementSize,
+                                    to + (start + rank) * elementSize,
+                                    nextTaken - taken,
+                                    (nextRank - nextTaken) - (rank - taken),
+                                    elementSize,
+                                    list->compare};
+                merges[count++] = task;
+                rank = nextRank;
+                taken = nextTaken;
+            }
+        }
+        if (runs % 2 == 1) {
+            memcpy(to + bounds[runs - 1] * elementSize,
+                   from + bounds[runs - 1] * elementSize,
+                   (bounds[runs] - bounds[runs - 1]) * elementSize);
+        }
+        __ParallelRun(__MergeWorker, merges, count, sizeof(__MergeTask),
+                      handles);
+
+        for (size_t i = 0; i < pairs; i++) bounds[i] = bounds[i * 2];
+        if (runs % 2 == 1) bounds[pairs] = bounds[runs - 1];
+        runs = (runs + 1) / 2;
+        bounds[runs] = list->Size;
+        void *temp = from;
+        from = to;
+        to = temp;
+    }
+    if (from != list->array) {
+        memcpy(list->array, from, list->Size * elementSize);
+    }
+
+    free(merges);
+    free(sorts);
+    free(handles);
+    free(bounds);
+    free(scratch);
+}
+
+/**
+ * @brief Map key bits of `type` to an unsigned key with the same order.
+ * O(1).
+ *
+ * @param key Raw key bits.
+ * @param keyBytes Width of keys in bytes.
+ * @param type How keys are ordered.
+ * @return unsigned long long Normalised key.
+ */
+static inline unsigned long long __normalise(unsigned long long key,
+                                             const unsigned int keyBytes,
+                                             const ArrayListKeyType type) {
+    const unsigned long long sign = 1ULL << (keyBytes * 8 - 1),
+                             mask = sign | (sign - 1);
+    key &= mask;
+    switch (type) {
+        case ARRAY_LIST_KEY_SIGNED:
+            return key ^ sign;
+        case ARRAY_LIST_KEY_FLOATING:
+            return key & sign ? ~key & mask : key | sign;
+        default:
+            return key;
+    }
+}
+
+/**
+ * @private
+ * @brief Key of an element and its index before sorting.
+ */
+typedef struct {
+    unsigned long long key;
+    size_t index;
+} __RadixEntry;
+
+void ArrayListRadixSort(ArrayList *const restrict list,
+                        KeyFunction *const keyExtractor,
+                        const unsigned int keyBytes,
+                        const ArrayListKeyType type) {
+    assert(list != NULL);
+    assert(keyExtractor != NULL);
+    assert(keyBytes > 0 && keyBytes <= 8);
+    assert(type != ARRAY_LIST_KEY_FLOATING || keyBytes == 4 || keyBytes == 8);
+    __ArrayListSettle(list);
+    if (list->Size < 2) return;
+    list->Sorted = FALSE;
+
+    __RadixEntry *from = malloc(list->Size * sizeof(__RadixEntry)),
+                 *to = malloc(list->Size * sizeof(__RadixEntry));
+    assert(from != NULL && to != NULL);
+    size_t counts[8][256] = {0};
+    for (size_t i = 0; i < list->Size; i++) {
+        from[i].key = __normalise(
+            keyExtractor(list->array + i * list->elementSize), keyBytes, type);
+        from[i].index = i;
+        for (unsigned int byte = 0; byte < keyBytes; byte++) {
+            counts[byte][(from[i].key >> (byte * 8)) & 0xFF]++;
+        }
+    }
+
+    for (unsigned int byte = 0; byte < keyBytes; byte++) {
+        // Every key has the same digit here, so this pass keeps the order.
+        if (counts[byte][(from[0].key >> (byte * 8)) & 0xFF] == list->Size) {
+            continue;
+        }
+        size_t offset = 0;
+        for (unsigned int digit = 0; digit < 256; digit++) {
+            const size_t count = counts[byte][digit];
+            counts[byte][digit] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < list->Size; i++) {
+            to[counts[byte][(from[i].key >> (byte * 8)) & 0xFF]++] = from[i];
+        }
+        __RadixEntry *temp = from;
+        from = to;
+        to = temp;
+    }
+
+    void *array = malloc((list->reserved != 0 ? list->Size : list->Capacity) *
+                         list->elementSize);
+    assert(array != NULL);
+    for (size_t i = 0; i < list->Size; i++) {
+        memcpy(array + i * list->elementSize,
+               list->array + from[i].index * list->elementSize,
+               list->elementSize);
+    }
+    if (list->reserved != 0) {
+        // A large list keeps its mapping, so elements are copied back.
+        memcpy(list->array, array, list->Size * list->elementSize);
+        free(array);
+    } else {
+        free(list->array - list->front * list->elementSize);
+        list->array = array;
+        list->front = 0;
+    }
+    free(to);
+    free(from);
+}
+
 ArrayListIterator ArrayListGetIterator(ArrayList *const restrict list) {
     assert(list != NULL);
+    __ArrayListSettle(list);
     ArrayListIterator iterator = {list->array, list->elementSize, 0,
                                   list->Size};
     return iterator;
@@ -249,6 +1466,7 @@ ArrayListIterator ArrayListGetIterator(ArrayList *const restrict list) {
 
 ArrayListIterator ArrayListGetReverseIterator(ArrayList *const restrict list) {
     assert(list != NULL);
+    __ArrayListSettle(list);
     ArrayListIterator iterator = {list->array, list->elementSize,
                                   list->Size - 1, list->Size};
     return iterator;
@@ -276,3 +1494,104 @@ void *ArrayListIteratorGetValue(ArrayListIterator const iterator) {
 Bool ArrayListIteratorEnded(ArrayListIterator const iterator) {
     return iterator.current == iterator.size || iterator.current == -1;
 }
+
+ArrayListView ArrayListGetView(ArrayList *const restrict list,
+                               const size_t start, const size_t size) {
+    assert(list != NULL);
+    assert(start <= list->Size && size <= list->Size - start);
+    __ArrayListSettle(list);
+    ArrayListView view = {list->array + start * list->elementSize,
+                          list->elementSize, list->compare, size,
+                          list->Sorted};
+    return view;
+}
+
+ArrayListView ArrayListViewGetView(const ArrayListView view, const size_t start,
+                                   const size_t size) {
+    assert(start <= view.Size && size <= view.Size - start);
+    ArrayListView result = {view.array + start * view.elementSize,
+                            view.elementSize, view.compare, size,
+                            view.Sorted};
+    return result;
+}
+
+void *ArrayListViewGet(const ArrayListView view, const size_t index) {
+    assert(index < view.Size);
+    return view.array + index * view.elementSize;
+}
+
+size_t ArrayListViewFind(const ArrayListView view,
+                         const void *const restrict value) {
+    assert(value != NULL);
+    if (view.Sorted) {
+        const size_t index = __bound(view.array, view.Size, view.elementSize,
+                                     view.compare, value, FALSE);
+        return index < view.Size &&
+                       view.compare(view.array + index * view.elementSize,
+                                    value) == 0
+                   ? index
+                   : (size_t)-1;
+    }
+    for (size_t i = 0; i < view.Size; i++) {
+        if (view.compare(view.array + i * view.elementSize, value) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+size_t ArrayListViewLowerBound(const ArrayListView view,
+                               const void *const restrict value) {
+    assert(value != NULL);
+    assert(view.Sorted || view.Size < 2);
+    return __bound(view.array, view.Size, view.elementSize, view.compare,
+                   value, FALSE);
+}
+
+size_t ArrayListViewUpperBound(const ArrayListView view,
+                               const void *const restrict value) {
+    assert(value != NULL);
+    assert(view.Sorted || view.Size < 2);
+    return __bound(view.array, view.Size, view.elementSize, view.compare,
+                   value, TRUE);
+}
+
+void ArrayListViewQuickSort(ArrayListView *const restrict view) {
+    assert(view != NULL);
+    view->Sorted = TRUE;
+    if (view->Size < 2) return;
+    void *cache = malloc(view->elementSize);
+    assert(cache != NULL);
+    unsigned int depth = 0;
+    for (size_t size = view->Size; size > 1; size >>= 1) depth += 2;
+    __IntroSort(view->array, view->Size, view->elementSize, view->compare,
+                cache, depth);
+    free(cache);
+}
+
+Bool ArrayListViewSome(const ArrayListView view, TestFunction *const test) {
+    assert(test != NULL);
+    for (size_t i = 0; i < view.Size; i++) {
+        if (test(view.array + i * view.elementSize) == TRUE) return TRUE;
+    }
+    return FALSE;
+}
+
+Bool ArrayListViewAll(const ArrayListView view, TestFunction *const test) {
+    assert(test != NULL);
+    for (size_t i = 0; i < view.Size; i++) {
+        if (test(view.array + i * view.elementSize) == FALSE) return FALSE;
+    }
+    return TRUE;
+}
+
+ArrayListIterator ArrayListViewGetIterator(const ArrayListView view) {
+    ArrayListIterator iterator = {view.array, view.elementSize, 0, view.Size};
+    return iterator;
+}
+
+ArrayListIterator ArrayListViewGetReverseIterator(const ArrayListView view) {
+    ArrayListIterator iterator = {view.array, view.elementSize, view.Size - 1,
+                                  view.Size};
+    return iterator;
+}
@@ -3,6 +3,27 @@
 
 #include "types.h"
 
+/**
+ * @brief Interpretation of keys returned by the `KeyFunction` passed to
+ * `ArrayListRadixSort()`.
+ */
+typedef enum {
+    /**
+     * @brief Unsigned integer.
+     */
+    ARRAY_LIST_KEY_UNSIGNED = 0,
+    /**
+     * @brief Two's complement signed integer.
+     */
+    ARRAY_LIST_KEY_SIGNED = 1,
+    /**
+     * @brief IEEE 754 bits of a `float` (4 key bytes) or `double` (8 key
+     * bytes). NaNs sort after positive infinity when their sign bit is
+     * clear.
+     */
+    ARRAY_LIST_KEY_FLOATING = 2
+} ArrayListKeyType;
+
 /**
  * @brief Iterator of `ArrayList`.
  * @attention This iterator has no void head node. You can call
@@ -11,8 +32,8 @@
 typedef struct {
     void *array;
     unsigned long elementSize;
-    unsigned int current;
-    unsigned int size;
+    size_t current;
+    size_t size;
 } ArrayListIterator;
 
 /**
@@ -24,11 +45,19 @@ typedef struct {
 typedef struct {
     /**
      * @private
-     * @brief All elements will be stored in this member.
+     * @brief All elements will be stored in this member. It refers to the
+     * first element, which is preceded by `front` unused slots of storage.
      * @warning Don't modify this member directly. Please use functions below.
      * @see `ArrayListGet()`, `ArrayListSet()`.
      */
     void *array;
+    /**
+     * @private
+     * @brief Count of unused slots before the first element, left by removals
+     * and reserved by insertions at the front.
+     * @warning Don't modify this member directly.
+     */
+    size_t front;
     /**
      * @private
      * @brief Element size of this list.
@@ -42,24 +71,149 @@ typedef struct {
      */
     CompareFunction *compare;
 
+    /**
+     * @private
+     * @brief Factor by which capacity is multiplied when this list is full.
+     * @warning Don't modify this member directly.
+     * @see `ArrayListSetGrowthFactor()`.
+     */
+    double growthFactor;
+    /**
+     * @private
+     * @brief Whether capacity is reduced automatically after removals.
+     * @warning Don't modify this member directly.
+     * @see `ArrayListSetAutoShrink()`.
+     */
+    Bool autoShrink;
+    /**
+     * @private
+     * @brief Bytes of address space reserved by a large list, or `0` if
+     * `array` is allocated from heap.
+     * @warning Don't modify this member directly.
+     * @see `ArrayListConstructLarge()`.
+     */
+    unsigned long reserved;
+    /**
+     * @private
+     * @brief Bytes at the beginning of `reserved` which are accessible.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long committed;
+    /**
+     * @private
+     * @brief Whether growth migrates elements incrementally.
+     * @warning Don't modify this member directly.
+     * @see `ArrayListSetIncremental()`.
+     */
+    Bool incremental;
+    /**
+     * @private
+     * @brief Storage before the last incremental growth, or `NULL` if no
+     * migration is in progress. Elements in `[migrated, limit)` are still
+     * stored here.
+     * @warning Don't modify this member directly.
+     */
+    void *previous;
+    /**
+     * @private
+     * @brief Count of unused slots before `previous` in its storage.
+     * @warning Don't modify this member directly.
+     */
+    size_t previousFront;
+    /**
+     * @private
+     * @brief Count of leading elements already moved out of `previous`.
+     * @warning Don't modify this member directly.
+     */
+    size_t migrated;
+    /**
+     * @private
+     * @brief End of the elements which are still to be moved out of
+     * `previous`.
+     * @warning Don't modify this member directly.
+     */
+    size_t limit;
+
     /**
      * @public
      * @brief Current element quantity of this list.
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Size;
+    size_t Size;
     /**
      * @public
-     * @brief Current element capacity of this list. If `Size` is going to be
-     * larger than `Capacity`, this list will automatically expand its
-     * capacity.
+     * @brief Current element capacity of this list, including unused slots
+     * before the first element. If `Size` is going to be larger than
+     * `Capacity`, this list will automatically expand its capacity.
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Capacity;
+    size_t Capacity;
+    /**
+     * @public
+     * @brief Whether elements are in ascending order of `compare`. Sorting
+     * and `ArrayListInsertSorted()` set it. Other functions which add or
+     * overwrite elements clear it, while removals keep it.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     * @warning Writing through pointers returned by `ArrayListGet()`,
+     * `ArrayListFront()`, iterators or views invalidates it without clearing
+     * it. Sort again after such writes, or the functions below may miss
+     * elements.
+     * @see `ArrayListFind()`, `ArrayListLowerBound()`,
+     * `ArrayListUpperBound()`, `ArrayListInsertSorted()`.
+     */
+    Bool Sorted;
 } ArrayList;
 
+/**
+ * @brief Borrowed view of a contiguous range of `ArrayList` elements. Nothing
+ * is copied or allocated, so views can be passed around by value and need no
+ * destruction.
+ * @warning A view refers to the storage of its list directly. Any call that
+ * may change the capacity of the list invalidates the view.
+ * @see `ArrayListGetView()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Pointer refers to the first element of the range.
+     * @warning Don't modify this member directly.
+     */
+    void *array;
+    /**
+     * @private
+     * @brief Element size of the viewed list.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Function used in comparing two elements.
+     * @warning Don't modify this member directly.
+     */
+    CompareFunction *compare;
+
+    /**
+     * @public
+     * @brief Element quantity of this view.
+     * @attention Don't change value of this member directly.
+     */
+    size_t Size;
+    /**
+     * @public
+     * @brief Whether elements are in ascending order of `compare`. Inherited
+     * from the list and set by `ArrayListViewQuickSort()`.
+     * @see `ArrayListViewFind()`, `ArrayListViewLowerBound()`,
+     * `ArrayListViewUpperBound()`.
+     * @attention Don't change value of this member directly.
+     * @warning Writing through pointers returned by `ArrayListViewGet()`
+     * invalidates it without clearing it.
+     */
+    Bool Sorted;
+} ArrayListView;
+
 /**
  * @brief Constructor function. O(1).
  *
@@ -69,7 +223,7 @@ typedef struct {
  * @param compare Function used in comparing two elements.
  */
 void ArrayListConstruct(ArrayList *const restrict list,
-                        const unsigned int initialCapacity,
+                        const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare);
 
@@ -81,10 +235,43 @@ void ArrayListConstruct(ArrayList *const restrict list,
  * @param compare Function used in comparing two elements.
  * @return ArrayList* Pointer refering to a list address.
  */
-ArrayList *ArrayListNew(const unsigned int initialCapacity,
+ArrayList *ArrayListNew(const size_t initialCapacity,
                         const unsigned long elementSize,
                         CompareFunction *const compare);
 
+/**
+ * @brief Construct a list for very large element quantities. Address space for
+ * `maximumCapacity` elements is reserved up front with `mmap()` and committed
+ * in 2 MiB steps as the list grows, so growth never moves or copies elements
+ * and never needs twice the memory. Transparent huge pages are requested for
+ * the reservation where the system supports them, and removed capacity is
+ * returned to the system page by page. O(1).
+ * @attention `Capacity` can't exceed `maximumCapacity`. Reserving address space
+ * costs no memory, so `maximumCapacity` may be generous.
+ *
+ * @param list Target to be constructed.
+ * @param maximumCapacity Maximum capacity of `list`.
+ * @param elementSize Element size of `list`.
+ * @param compare Function used in comparing two elements.
+ */
+void ArrayListConstructLarge(ArrayList *const restrict list,
+                             const size_t maximumCapacity,
+                             const unsigned long elementSize,
+                             CompareFunction *const compare);
+
+/**
+ * @brief Allocate a new large list in heap. O(1).
+ * @see `ArrayListConstructLarge()`.
+ *
+ * @param maximumCapacity Maximum capacity of list.
+ * @param elementSize Element size of list.
+ * @param compare Function used in comparing two elements.
+ * @return ArrayList* Pointer refering to a heap address.
+ */
+ArrayList *ArrayListNewLarge(const size_t maximumCapacity,
+                             const unsigned long elementSize,
+                             CompareFunction *const compare);
+
 /**
  * @brief Destruct function. O(1).
  *
@@ -100,6 +287,62 @@ void ArrayListDestruct(ArrayList *const restrict list);
  */
 void ArrayListDelete(ArrayList **const restrict list);
 
+/**
+ * @brief Set the factor by which capacity of `list` is multiplied when it is
+ * full. It is `2` by default. O(1).
+ *
+ * @param list `this`.
+ * @param factor Growth factor. It must be greater than `1`.
+ */
+void ArrayListSetGrowthFactor(ArrayList *const restrict list,
+                              const double factor);
+
+/**
+ * @brief Enable or disable automatic shrinking of `list`. When enabled, the
+ * capacity is reduced to `Size` times the growth factor once `Size` falls to
+ * `Capacity` divided by the square of the growth factor, so that alternating
+ * pushes and removals near the boundary don't reallocate repeatedly. It is
+ * disabled by default. O(1).
+ *
+ * @param list `this`.
+ * @param autoShrink `TRUE` to enable.
+ */
+void ArrayListSetAutoShrink(ArrayList *const restrict list,
+                            const Bool autoShrink);
+
+/**
+ * @brief Enable or disable incremental growth of `list`. When enabled, a full
+ * list allocates its new storage without copying, and then moves a bounded
+ * number of elements on each following `ArrayListPushBack()`,
+ * `ArrayListPopBack()` and `ArrayListSet()`, so that the migration is
+ * finished before the list is full again. These functions, `ArrayListGet()`
+ * and `ArrayListBack()` work on both storages in O(1), while any other
+ * function finishes a pending migration first. Large lists never copy on
+ * growth, so the setting has no effect on them. It is disabled by default.
+ * O(1), or O(n) if disabling it finishes a migration.
+ *
+ * @param list `this`.
+ * @param incremental `TRUE` to enable.
+ */
+void ArrayListSetIncremental(ArrayList *const restrict list,
+                             const Bool incremental);
+
+/**
+ * @brief Make sure that `list` can hold `capacity` elements without
+ * reallocation. O(n).
+ *
+ * @param list `this`.
+ * @param capacity Required capacity.
+ */
+void ArrayListReserve(ArrayList *const restrict list, const size_t capacity);
+
+/**
+ * @brief Reduce capacity of `list` to its size, but at least `1`. O(n).
+ *
+ * @param list `this`.
+ */
+void ArrayListShrinkToFit(ArrayList *const restrict list);
+
 /**
  * @brief Get the value of the element at specified `index`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
@@ -109,8 +352,7 @@ void ArrayListDelete(ArrayList **const restrict list);
  * @return void* If successful, the element will be returned. Otherwise, `NULL`
  * will be returned.
  */
-void *ArrayListGet(const ArrayList *const restrict list,
-                   const unsigned int index);
+void *ArrayListGet(const ArrayList *const restrict list, const size_t index);
 
 /**
  * @brief Set the value of element at specified `index`. O(1).
@@ -119,7 +361,7 @@ void *ArrayListGet(const ArrayList *const restrict list,
  * @param index Specified index.
  * @param value Value of element. It will be DEEP copied.
  */
-void ArrayListSet(ArrayList *const restrict list, const unsigned int index,
+void ArrayListSet(ArrayList *const restrict list, const size_t index,
                   const void *const restrict value);
 
 /**
@@ -132,13 +374,15 @@ void ArrayListSet(ArrayList *const restrict list, const unsigned int index,
 void *ArrayListBack(const ArrayList *const restrict list);
 
 /**
- * @brief Get value of the first element. O(1).
+ * @brief Get value of the first element. All elements follow it contiguously,
+ * so a pending incremental migration is finished first. O(1), or O(n) during
+ * a migration.
  * @attention The returned value is shallow copied. Don't free it.
  *
  * @param list `this`.
  * @return void* If `list` is empty, `NULL` will be returned.
  */
-void *ArrayListFront(const ArrayList *const restrict list);
+void *ArrayListFront(ArrayList *const restrict list);
 
 /**
  * @brief Add new element at the end of `list`. O(1).
@@ -157,7 +401,9 @@ void ArrayListPushBack(ArrayList *const restrict list,
 void ArrayListPopBack(ArrayList *const restrict list);
 
 /**
- * @brief Add new element at the begin of `list`. O(n).
+ * @brief Add new element at the begin of `list`. Free slots are kept before
+ * the first element, so that no element is moved unless they run out.
+ * Amortized O(1).
  *
  * @param list `this`.
  * @param value Value of element. It will be DEEP copied.
@@ -166,7 +412,8 @@ void ArrayListPushFront(ArrayList *const restrict list,
                         const void *const restrict value);
 
 /**
- * @brief Remove the first element of `list`. O(n).
+ * @brief Remove the first element of `list`. Its slot is kept for following
+ * insertions at the front. O(1).
  *
  * @param list `this`.
  */
@@ -174,24 +421,106 @@ void ArrayListPopFront(ArrayList *const restrict list);
 
 /**
  * @brief Add new element at the specified index of `list`. After element
- * added, `list[index]` will be the new element. O(n).
+ * added, `list[index]` will be the new element. Elements on the shorter side
+ * of `index` are shifted. O(min(index, n - index)) amortized.
  *
  * @param list `this`.
  * @param value Value of element. It will be DEEP copied.
  */
-void ArrayListInsert(ArrayList *const restrict list, const unsigned int index,
+void ArrayListInsert(ArrayList *const restrict list, const size_t index,
                      const void *const restrict value);
 
 /**
- * @brief Find the element which is equal to `value`. O(n).
+ * @brief Add `count` new elements at the specified index of `list`. After
+ * elements added, `list[index]` will be the first new element. Capacity grows
+ * at most once, and elements on the shorter side of `index` are shifted.
+ * O(n + count).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @param values Pointer refers to `count` contiguous values. They will be DEEP
+ * copied.
+ * @param count Value count.
+ */
+void ArrayListInsertRange(ArrayList *const restrict list, const size_t index,
+                          const void *const restrict values,
+                          const size_t count);
+
+/**
+ * @brief Remove `count` elements from the specified index of `list`. Elements
+ * on the shorter side of the removed range are shifted. O(n).
+ *
+ * @param list `this`.
+ * @param index Index of the first removed element.
+ * @param count Element count.
+ */
+void ArrayListErase(ArrayList *const restrict list, const size_t index,
+                    const size_t count);
+
+/**
+ * @brief Remove every element whose value makes `test()` return `TRUE`. The
+ * rest keep their order. O(n).
+ *
+ * @param list `this`.
+ * @param test Function used in checking if an element should be removed.
+ * @return size_t Removed element count.
+ */
+size_t ArrayListRemoveIf(ArrayList *const restrict list,
+                         TestFunction *const test);
+
+/**
+ * @brief Find the first element which is equal to `value`. If `list->Sorted`
+ * is set, branchless binary search is used. O(log₂n) if sorted, otherwise
+ * O(n).
  *
  * @param list `this`.
  * @param value Specified value.
- * @return int If found, the index of the element will be returned. Otherwise,
- * `-1` will be returned.
+ * @return size_t If found, the index of the element will be returned.
+ * Otherwise, `(size_t)-1` will be returned.
  */
-int ArrayListFind(const ArrayList *const restrict list,
-                  const void *const restrict value);
+size_t ArrayListFind(const ArrayList *const restrict list,
+                     const void *const restrict value);
+
+/**
+ * @brief Get index of the first element which is not less than `value`.
+ * O(log₂n).
+ *
+ * @param list `this`.
+ * @param value Specified value.
+ * @return size_t Index of the element. If every element is less than
+ * `value`, `list->Size` will be returned.
+ * @attention `list->Sorted` must be set, unless `list` has less than two
+ * elements.
+ */
+size_t ArrayListLowerBound(const ArrayList *const restrict list,
+                           const void *const restrict value);
+
+/**
+ * @brief Get index of the first element which is greater than `value`.
+ * O(log₂n).
+ *
+ * @param list `this`.
+ * @param value Specified value.
+ * @return size_t Index of the element. If no element is greater than
+ * `value`, `list->Size` will be returned.
+ * @attention `list->Sorted` must be set, unless `list` has less than two
+ * elements.
+ */
+size_t ArrayListUpperBound(const ArrayList *const restrict list,
+                           const void *const restrict value);
+
+/**
+ * @brief Add new element to `list`, keeping ascending order. The new element
+ * is placed after elements equal to it. O(n).
+ *
+ * @param list `this`.
+ * @param value Value of element. It will be DEEP copied.
+ * @return size_t Index of the new element.
+ * @attention `list->Sorted` must be set, unless `list` has less than two
+ * elements.
+ */
+size_t ArrayListInsertSorted(ArrayList *const restrict list,
+                             const void *const restrict value);
 
 /**
  * @brief Slice `list`, and return new list which contains DEEP copied
@@ -204,15 +533,64 @@ int ArrayListFind(const ArrayList *const restrict list,
  * automatically be released.
  */
 ArrayList *ArrayListSlice(const ArrayList *const restrict list,
-                          const unsigned int start, const unsigned int size);
+                          const size_t start, const size_t size);
+
+/**
+ * @brief Return new list which contains DEEP copied elements of `list` that
+ * satisfy `test()`, in their original order. Elements are passed into
+ * `test()` in spans of up to 64 elements. O(n).
+ *
+ * @param list `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return ArrayList* New list with DEEP copied elements. This pointer will NOT
+ * automatically be released.
+ */
+ArrayList *ArrayListFilter(const ArrayList *const restrict list,
+                           BatchTestFunction *const test);
 
 /**
- * @brief Use quick sort algorithm to sort `list`. O(nlog₂n).
+ * @brief Use quick sort algorithm to sort `list`. Implemented as introsort:
+ * falls back to heap sort on adversarial input, so the bound holds in the
+ * worst case. Not stable. O(nlog₂n).
  *
  * @param list `this`.
  */
 void ArrayListQuickSort(ArrayList *const restrict list);
 
+/**
+ * @brief Sort `list` on several threads. Runs are sorted concurrently and
+ * then merged pairwise, each merge split across threads. Lists too short to
+ * benefit are sorted on the calling thread. O(nlog₂n / threads + n).
+ *
+ * @param list `this`.
+ * @param threads Thread count. `0` means one per online processor.
+ * @param stable Whether equal elements keep their relative order. A stable
+ * sort gives the same result as a sequential stable sort.
+ * @attention Allocates a scratch buffer as large as `list`.
+ */
+void ArrayListParallelSort(ArrayList *const restrict list, unsigned int threads,
+                           const Bool stable);
+
+/**
+ * @brief Use LSD radix sort algorithm to sort `list` by the key extracted
+ * from each element. Keys are extracted once, then sorted byte by byte;
+ * bytes shared by all keys are skipped. Stable. O(n·keyBytes).
+ * @attention Key order may differ from `compare`, so `list->Sorted` will be
+ * cleared.
+ *
+ * @param list `this`.
+ * @param keyExtractor Function returning the key of an element.
+ * @param keyBytes Width of keys in bytes, between 1 and 8.
+ * @param type How keys are ordered.
+ * @attention Allocates a new element array and two key arrays of `Size`
+ * entries.
+ */
+void ArrayListRadixSort(ArrayList *const restrict list,
+                        KeyFunction *const keyExtractor,
+                        const unsigned int keyBytes,
+                        const ArrayListKeyType type);
+
 /**
  * @brief Get iterator of `list`. O(1).
  *
@@ -261,4 +639,130 @@ void *ArrayListIteratorGetValue(ArrayListIterator const iterator);
  */
 Bool ArrayListIteratorEnded(ArrayListIterator const iterator);
 
+/**
+ * @brief Get view of `size` elements of `list` from index `start`(contained).
+ * O(1).
+ *
+ * @param list `this`.
+ * @param start Start index.
+ * @param size Element count of the view.
+ * @return ArrayListView View borrowing storage of `list`.
+ */
+ArrayListView ArrayListGetView(ArrayList *const restrict list,
+                               const size_t start, const size_t size);
+
+/**
+ * @brief Get view of `size` elements of `view` from index `start`(contained).
+ * O(1).
+ *
+ * @param view `this`.
+ * @param start Start index.
+ * @param size Element count of the returned view.
+ * @return ArrayListView View borrowing the same storage as `view`.
+ */
+ArrayListView ArrayListViewGetView(const ArrayListView view, const size_t start,
+                                   const size_t size);
+
+/**
+ * @brief Get the value of the element at specified `index`. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param view `this`.
+ * @param index Specified index.
+ * @return void* The element.
+ */
+void *ArrayListViewGet(const ArrayListView view, const size_t index);
+
+/**
+ * @brief Find the first element which is equal to `value`. If `view.Sorted`
+ * is set, branchless binary search is used. O(log₂n) if sorted, otherwise
+ * O(n).
+ *
+ * @param view `this`.
+ * @param value Specified value.
+ * @return size_t If found, the index of the element in `view` will be returned.
+ * Otherwise, `(size_t)-1` will be returned.
+ */
+size_t ArrayListViewFind(const ArrayListView view,
+                         const void *const restrict value);
+
+/**
+ * @brief Get index of the first element which is not less than `value`.
+ * O(log₂n).
+ *
+ * @param view `this`.
+ * @param value Specified value.
+ * @return size_t Index of the element. If every element is less than
+ * `value`, `view.Size` will be returned.
+ * @attention `view.Sorted` must be set, unless `view` has less than two
+ * elements.
+ */
+size_t ArrayListViewLowerBound(const ArrayListView view,
+                               const void *const restrict value);
+
+/**
+ * @brief Get index of the first element which is greater than `value`.
+ * O(log₂n).
+ *
+ * @param view `this`.
+ * @param value Specified value.
+ * @return size_t Index of the element. If no element is greater than
+ * `value`, `view.Size` will be returned.
+ * @attention `view.Sorted` must be set, unless `view` has less than two
+ * elements.
+ */
+size_t ArrayListViewUpperBound(const ArrayListView view,
+                               const void *const restrict value);
+
+/**
+ * @brief Sort the viewed range in place, using the same algorithm as
+ * `ArrayListQuickSort()`. Elements outside the view are untouched. Not
+ * stable. O(nlog₂n).
+ *
+ * @param view Pointer refers to `this`.
+ */
+void ArrayListViewQuickSort(ArrayListView *const restrict view);
+
+/**
+ * @brief Every value of elements in `view` will be passed into `test()`. If
+ * `test()` returns `TRUE`, `TRUE` will be returned immediately. If `FALSE` is
+ * always returned by `test()`, `FALSE` will be returned. O(n).
+ *
+ * @param view `this`.
+ * @param test Function used in checking if some elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool ArrayListViewSome(const ArrayListView view, TestFunction *const test);
+
+/**
+ * @brief Every value of elements in `view` will be passed into `test()`. If
+ * `test()` returns `FALSE`, `FALSE` will be returned immediately. If `TRUE` is
+ * always returned by `test()`, `TRUE` will be returned. O(n).
+ *
+ * @param view `this`.
+ * @param test Function used in checking if some elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool ArrayListViewAll(const ArrayListView view, TestFunction *const test);
+
+/**
+ * @brief Get iterator of `view`. The iterator is an ordinary
+ * `ArrayListIterator`. O(1).
+ *
+ * @param view `this`.
+ * @return ArrayListIterator Iterator.
+ */
+ArrayListIterator ArrayListViewGetIterator(const ArrayListView view);
+
+/**
+ * @brief Get reverse iterator of `view`. The iterator is an ordinary
+ * `ArrayListIterator`. O(1).
+ *
+ * @param view `this`.
+ * @return ArrayListIterator Iterator.
+ */
+ArrayListIterator ArrayListViewGetReverseIterator(const ArrayListView view);
+
 #endif  // __COLLECTIONS_ARRAY_LIST__
@@ -3,9 +3,12 @@
 #include <assert.h>
 #include <malloc.h>
 #include <memory.h>
+#include <stdint.h>
+
+#include "batch-test.h"
 
 void ArrayQueueConstruct(ArrayQueue *const restrict queue,
-                         const unsigned int initialCapacity,
+                         const size_t initialCapacity,
                          const unsigned long elementSize) {
     assert(queue != NULL);
     assert(initialCapacity > 0);
@@ -13,12 +16,20 @@ void ArrayQueueConstruct(ArrayQueue *const restrict queue,
 
     queue->array = calloc(initialCapacity, elementSize);
     assert(queue->array != NULL);
+    queue->front = 0;
     queue->Capacity = initialCapacity;
     queue->elementSize = elementSize;
+    queue->growthFactor = 2;
+    queue->autoShrink = FALSE;
+    queue->incremental = FALSE;
+    queue->previous = NULL;
+    queue->previousFront = 0;
+    queue->migrated = 0;
+    queue->limit = 0;
     queue->Size = 0;
 }
 
-ArrayQueue *ArrayQueueNew(const unsigned int initialCapacity,
+ArrayQueue *ArrayQueueNew(const size_t initialCapacity,
                           const unsigned long elementSize) {
     ArrayQueue *queue = (ArrayQueue *)malloc(sizeof(ArrayQueue));
     ArrayQueueConstruct(queue, initialCapacity, elementSize);
@@ -29,6 +40,13 @@ void ArrayQueueDestruct(ArrayQueue *const restrict queue) {
     if (queue == NULL) return;
 
     free(queue->array);
+    free(queue->previous);
+    queue->array = NULL;
+    queue->previous = NULL;
+    queue->front = 0;
+    queue->previousFront = 0;
+    queue->migrated = 0;
+    queue->limit = 0;
     queue->Capacity = 0;
     queue->elementSize = 0;
     queue->Size = 0;
@@ -41,37 +59,281 @@ void ArrayQueueDelete(ArrayQueue **const restrict queue) {
     *queue = NULL;
 }
 
+/**
+ * @brief Get the slot of `queue->array` assigned to the element at `index`.
+ * O(1).
+ *
+ * @param queue `this`.
+ * @param index Specified index. It may be `queue->Size`.
+ * @return size_t The slot.
+ */
+static inline size_t __slot(const ArrayQueue *const queue,
+                            const size_t index) {
+    const size_t slot = queue->front + index;
+    return slot < queue->Capacity ? slot : slot - queue->Capacity;
+}
+
+/**
+ * @brief Get element at `index`, wherever it is stored during an incremental
+ * migration. O(1).
+ *
+ * @param queue `this`.
+ * @param index Specified index.
+ * @return void* The element.
+ */
+static inline void *__at(const ArrayQueue *const queue, const size_t index) {
+    const size_t slot = __slot(queue, index);
+    if (slot >= queue->migrated && slot < queue->limit) {
+        size_t previous = queue->previousFront + slot;
+        if (previous >= queue->limit) previous -= queue->limit;
+        return queue->previous + previous * queue->elementSize;
+    }
+    return queue->array + slot * queue->elementSize;
+}
+
+/**
+ * @brief Get the end of the run of elements which starts at `index` and is
+ * contiguous in one storage. O(1).
+ *
+ * @param queue `this`.
+ * @param index Index of the first element of the run.
+ * @return size_t Index after the last element of the run.
+ */
+static size_t __ArrayQueueRun(const ArrayQueue *const queue,
+                              const size_t index) {
+    const size_t slot = __slot(queue, index);
+    size_t length = queue->Capacity - slot;
+    if (slot >= queue->migrated && slot < queue->limit) {
+        // `previous` is a ring of `limit` slots as well.
+        size_t previous = queue->previousFront + slot;
+        if (previous >= queue->limit) previous -= queue->limit;
+        length = queue->limit - (previous > slot ? previous : slot);
+    } else if (slot < queue->migrated) {
+        length = queue->migrated - slot;
+    }
+    return length < queue->Size - index ? index + length : queue->Size;
+}
+
+/**
+ * @brief Move up to `count` pending elements out of `queue->previous`, and
+ * release it once it is empty. O(count).
+ *
+ * @param queue `this`.
+ * @param count Maximum count of moved elements.
+ */
+static void __ArrayQueueMigrate(ArrayQueue *const restrict queue,
+                                size_t count) {
+    if (queue->previous == NULL) return;
+    // Popped elements don't need to be moved.
+    if (queue->migrated < queue->front) queue->migrated = queue->front;
+    size_t from = 0, length = 0;
+    while (count > 0 && queue->migrated < queue->limit) {
+        from = queue->previousFront + queue->migrated;
+        if (from >= queue->limit) from -= queue->limit;
+        length = queue->limit - queue->migrated;
+        if (length > queue->limit - from) length = queue->limit - from;
+        if (length > count) length = count;
+        memcpy(queue->array + queue->migrated * queue->elementSize,
+               queue->previous + from * queue->elementSize,
+               length * queue->elementSize);
+        queue->migrated += length;
+        count -= length;
+    }
+    if (queue->migrated >= queue->limit) {
+        free(queue->previous);
+        queue->previous = NULL;
+        queue->previousFront = 0;
+        queue->migrated = 0;
+        queue->limit = 0;
+    }
+}
+
+/**
+ * @brief Move one step of pending elements, enough to finish the migration
+ * before `queue` is full again. O(1).
+ *
+ * @param queue `this`.
+ */
+static inline void __ArrayQueueStep(ArrayQueue *const restrict queue) {
+    if (queue->previous == NULL) return;
+    __ArrayQueueMigrate(queue,
+                        queue->limit / (queue->Capacity - queue->limit) + 1);
+}
+
+/**
+ * @brief Finish a pending migration, so that all elements are in
+ * `queue->array`. O(n).
+ *
+ * @param queue `this`.
+ */
+static inline void __ArrayQueueSettle(ArrayQueue *const restrict queue) {
+    if (queue->previous != NULL) __ArrayQueueMigrate(queue, SIZE_MAX);
+}
+
+/**
+ * @brief Reallocate storage of `queue` to hold exactly `capacity` elements.
+ * Wrapped elements are unwrapped, so the first element moves to slot `0`.
+ * O(n).
+ *
+ * @param queue `this`.
+ * @param capacity New capacity. It must not be less than `queue->Size`.
+ */
+static void __ArrayQueueResize(ArrayQueue *const restrict queue,
+                               const size_t capacity) {
+    assert(capacity <= SIZE_MAX / queue->elementSize);
+    __ArrayQueueSettle(queue);
+    void *temp = NULL;
+    if (queue->front == 0) {
+        temp = realloc(queue->array, capacity * queue->elementSize);
+        assert(temp != NULL);
+    } else {
+        temp = malloc(capacity * queue->elementSize);
+        assert(temp != NULL);
+        const size_t head = queue->Capacity - queue->front < queue->Size
+                                ? queue->Capacity - queue->front
+                                : queue->Size;
+        memcpy(temp, queue->array + queue->front * queue->elementSize,
+               head * queue->elementSize);
+        memcpy(temp + head * queue->elementSize, queue->array,
+               (queue->Size - head) * queue->elementSize);
+        free(queue->array);
+        queue->front = 0;
+    }
+    queue->array = temp;
+    queue->Capacity = capacity;
+}
+
+/**
+ * @brief Make sure that `queue` can hold `size` elements, multiplying its
+ * capacity by the growth factor as many times as needed. O(n).
+ *
+ * @param queue `this`.
+ * @param size Required capacity.
+ */
+static void __ArrayQueueReserve(ArrayQueue *const restrict queue,
+                                const size_t size) {
+    if (size <= queue->Capacity) return;
+    // Growth stops at the largest capacity whose byte size can be represented.
+    const size_t maximum = SIZE_MAX / queue->elementSize;
+    assert(size <= maximum);
+    size_t capacity = queue->Capacity;
+    while (capacity < size) {
+        const double next = capacity * queue->growthFactor;
+        if (next >= maximum) {
+            capacity = maximum;
+        } else {
+            capacity = next >= capacity + 1 ? next : capacity + 1;
+        }
+    }
+    __ArrayQueueResize(queue, capacity);
+}
+
+/**
+ * @brief Make room for one more element of a full `queue`. In incremental
+ * mode, new storage is allocated without copying, and pending elements are
+ * moved by the following operations. O(1) in incremental mode, O(n)
+ * otherwise.
+ *
+ * @param queue `this`.
+ */
+static void __ArrayQueueGrow(ArrayQueue *const restrict queue) {
+    if (queue->Size < queue->Capacity) return;
+    if (!queue->incremental || queue->Size == 0) {
+        __ArrayQueueReserve(queue, queue->Size + 1);
+        return;
+    }
+    // The previous migration is always finished before the queue fills up
+    // again, unless the growth factor was changed in between.
+    __ArrayQueueSettle(queue);
+    const size_t maximum = SIZE_MAX / queue->elementSize;
+    assert(queue->Size < maximum);
+    const double next = queue->Capacity * queue->growthFactor;
+    size_t capacity = next >= maximum ? maximum : next;
+    if (capacity <= queue->Capacity) capacity = queue->Capacity + 1;
+    void *temp = malloc(capacity * queue->elementSize);
+    assert(temp != NULL);
+    queue->previous = queue->array;
+    queue->previousFront = queue->front;
+    queue->array = temp;
+    queue->front = 0;
+    queue->migrated = 0;
+    queue->limit = queue->Size;
+    queue->Capacity = capacity;
+}
+
+/**
+ * @brief Reduce capacity of `queue` after removals if automatic shrinking is
+ * enabled and `queue` is sparse enough. O(n) when shrinking, O(1) otherwise.
+ *
+ * @param queue `this`.
+ */
+static void __ArrayQueueShrink(ArrayQueue *const restrict queue) {
+    if (!queue->autoShrink) return;
+    const double factor = queue->growthFactor;
+    if (queue->Size * factor * factor > queue->Capacity) return;
+    const double target = queue->Size * factor;
+    const size_t capacity = target < 1 ? 1 : target;
+    if (capacity < queue->Capacity) __ArrayQueueResize(queue, capacity);
+}
+
+void ArrayQueueSetGrowthFactor(ArrayQueue *const restrict queue,
+                               const double factor) {
+    assert(queue != NULL);
+    assert(factor > 1);
+    queue->growthFactor = factor;
+}
+
+void ArrayQueueSetAutoShrink(ArrayQueue *const restrict queue,
+                             const Bool autoShrink) {
+    assert(queue != NULL);
+    queue->autoShrink = autoShrink;
+}
+
+void ArrayQueueSetIncremental(ArrayQueue *const restrict queue,
+                              const Bool incremental) {
+    assert(queue != NULL);
+    queue->incremental = incremental;
+    if (!incremental) __ArrayQueueSettle(queue);
+}
+
+void ArrayQueueReserve(ArrayQueue *const restrict queue,
+                       const size_t capacity) {
+    assert(queue != NULL);
+    if (capacity > queue->Capacity) __ArrayQueueResize(queue, capacity);
+}
+
+void ArrayQueueShrinkToFit(ArrayQueue *const restrict queue) {
+    assert(queue != NULL);
+    const size_t capacity = queue->Size > 0 ? queue->Size : 1;
+    if (capacity != queue->Capacity) __ArrayQueueResize(queue, capacity);
+}
+
 void *ArrayQueueFront(const ArrayQueue *const restrict queue) {
     assert(queue != NULL);
     assert(queue->Size > 0);
-    return queue->array;
+    return __at(queue, 0);
 }
 
 void ArrayQueuePush(ArrayQueue *const restrict queue,
                     const void *const restrict value) {
     assert(queue != NULL);
     assert(value != NULL);
-    void *temp = NULL;
-    if (queue->Size == queue->Capacity) {
-        queue->Capacity *= 2;
-        temp = calloc(queue->Capacity, queue->elementSize);
-        assert(temp != NULL);
-        memcpy(temp, queue->array, queue->Size * queue->elementSize);
-        free(queue->array);
-        queue->array = temp;
-    }
-    memcpy(queue->array + queue->Size * queue->elementSize, value,
-           queue->elementSize);
+    __ArrayQueueGrow(queue);
+    // New slots are never pending, so they are always in `queue->array`.
+    memcpy(queue->array + __slot(queue, queue->Size) * queue->elementSize,
+           value, queue->elementSize);
     queue->Size++;
+    __ArrayQueueStep(queue);
 }
 
 void ArrayQueuePop(ArrayQueue *const restrict queue) {
     assert(queue != NULL);
     assert(queue->Size > 0);
 
+    queue->front = __slot(queue, 1);
     queue->Size--;
-    memmove(queue->array, queue->array + queue->elementSize,
-            queue->Size * queue->elementSize);
+    __ArrayQueueStep(queue);
+    __ArrayQueueShrink(queue);
 }
 
 Bool ArrayQueueSome(ArrayQueue *const restrict queue,
@@ -79,10 +341,8 @@ Bool ArrayQueueSome(ArrayQueue *const restrict queue,
     assert(queue != NULL);
     assert(test != NULL);
 
-    void *temp = NULL;
-    for (unsigned int i = 0; i < queue->Size; i++) {
-        temp = queue->array + i * queue->elementSize;
-        if (test(temp) == TRUE) return TRUE;
+    for (size_t i = 0; i < queue->Size; i++) {
+        if (test(__at(queue, i)) == TRUE) return TRUE;
     }
     return FALSE;
 }
@@ -91,33 +351,69 @@ Bool ArrayQueueAll(ArrayQueue *const restrict queue, TestFunction *const test) {
     assert(queue != NULL);
     assert(test != NULL);
 
-    void *temp = NULL;
-    for (unsigned int i = 0; i < queue->Size; i++) {
-        temp = queue->array + i * queue->elementSize;
-        if (test(temp) == FALSE) return FALSE;
+    for (size_t i = 0; i < queue->Size; i++) {
+        if (test(__at(queue, i)) == FALSE) return FALSE;
+    }
+    return TRUE;
+}
+
+Bool ArrayQueueSomeBatch(ArrayQueue *const restrict queue,
+                         BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+
+    // Spans never cross the end of a storage, so each one is contiguous.
+    size_t run = 0;
+    for (size_t i = 0; i < queue->Size; i += run) {
+        run = __ArrayQueueRun(queue, i) - i;
+        if (run > 64) run = 64;
+        if (__BatchTestDecided(test(__at(queue, i), run), run, TRUE)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+Bool ArrayQueueAllBatch(ArrayQueue *const restrict queue,
+                        BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+
+    // Spans never cross the end of a storage, so each one is contiguous.
+    size_t run = 0;
+    for (size_t i = 0; i < queue->Size; i += run) {
+        run = __ArrayQueueRun(queue, i) - i;
+        if (run > 64) run = 64;
+        if (__BatchTestDecided(test(__at(queue, i), run), run, FALSE)) {
+            return FALSE;
+        }
     }
     return TRUE;
 }
 
 ArrayQueueIterator ArrayQueueGetIterator(ArrayQueue *const restrict queue) {
     assert(queue != NULL);
+    __ArrayQueueSettle(queue);
     ArrayQueueIterator iterator = {queue->array, queue->elementSize, 0,
-                                   queue->Size};
+                                   queue->Size, queue->front, queue->Capacity};
     return iterator;
 }
 
 ArrayQueueIterator ArrayQueueGetReverseIterator(
     ArrayQueue *const restrict queue) {
     assert(queue != NULL);
+    __ArrayQueueSettle(queue);
     ArrayQueueIterator iterator = {queue->array, queue->elementSize,
-                                   queue->Size - 1, queue->Size};
+                                   queue->Size - 1, queue->Size, queue->front,
+                                   queue->Capacity};
     return iterator;
 }
 
 ArrayQueueIterator ArrayQueueIteratorNext(ArrayQueueIterator const iterator) {
     assert(iterator.current < iterator.size);
     ArrayQueueIterator i = {iterator.array, iterator.elementSize,
-                            iterator.current + 1, iterator.size};
+                            iterator.current + 1, iterator.size, iterator.front,
+                            iterator.capacity};
     return i;
 }
 
@@ -125,13 +421,16 @@ ArrayQueueIterator ArrayQueueIteratorPrevious(
     ArrayQueueIterator const iterator) {
     assert(iterator.current != -1);
     ArrayQueueIterator i = {iterator.array, iterator.elementSize,
-                            iterator.current - 1, iterator.size};
+                            iterator.current - 1, iterator.size, iterator.front,
+                            iterator.capacity};
     return i;
 }
 
 void *ArrayQueueIteratorGetValue(ArrayQueueIterator const iterator) {
     assert(iterator.current < iterator.size && iterator.current != -1);
-    return iterator.array + iterator.current * iterator.elementSize;
+    size_t slot = iterator.front + iterator.current;
+    if (slot >= iterator.capacity) slot -= iterator.capacity;
+    return iterator.array + slot * iterator.elementSize;
 }
 
 Bool ArrayQueueIteratorEnded(ArrayQueueIterator const iterator) {
@@ -11,8 +11,10 @@
 typedef struct {
     void *array;
     unsigned long elementSize;
-    unsigned int current;
-    unsigned int size;
+    size_t current;
+    size_t size;
+    size_t front;
+    size_t capacity;
 } ArrayQueueIterator;
 
 /**
@@ -24,11 +26,18 @@ typedef struct {
 typedef struct {
     /**
      * @private
-     * @brief Pointer refers to the first element.
+     * @brief Ring buffer which holds all elements. Elements wrap around to
+     * its start once they reach its end.
      * @warning Don't modify this member directly. Please use functions below.
      * @see `ArrayQueueTop()`, `ArrayQueuePop()`.
      */
     void *array;
+    /**
+     * @private
+     * @brief Slot of the first element in `array`.
+     * @warning Don't modify this member directly.
+     */
+    size_t front;
     /**
      * @private
      * @brief Element size of this queue.
@@ -36,13 +45,64 @@ typedef struct {
      */
     unsigned long elementSize;
 
+    /**
+     * @private
+     * @brief Factor by which capacity is multiplied when this queue is full.
+     * @warning Don't modify this member directly.
+     * @see `ArrayQueueSetGrowthFactor()`.
+     */
+    double growthFactor;
+    /**
+     * @private
+     * @brief Whether capacity is reduced automatically after removals.
+     * @warning Don't modify this member directly.
+     * @see `ArrayQueueSetAutoShrink()`.
+     */
+    Bool autoShrink;
+    /**
+     * @private
+     * @brief Whether growth migrates elements incrementally.
+     * @warning Don't modify this member directly.
+     * @see `ArrayQueueSetIncremental()`.
+     */
+    Bool incremental;
+    /**
+     * @private
+     * @brief Storage before the last incremental growth, or `NULL` if no
+     * migration is in progress. Elements whose slots in `array` are in
+     * `[migrated, limit)` are still stored here.
+     * @warning Don't modify this member directly.
+     */
+    void *previous;
+    /**
+     * @private
+     * @brief Slot of the element in `previous` which moves to slot `0` of
+     * `array`.
+     * @warning Don't modify this member directly.
+     */
+    size_t previousFront;
+    /**
+     * @private
+     * @brief Count of leading slots of `array` which need no element from
+     * `previous` any more.
+     * @warning Don't modify this member directly.
+     */
+    size_t migrated;
+    /**
+     * @private
+     * @brief Capacity of `previous`, which is also the end of the slots still
+     * to be moved out of it.
+     * @warning Don't modify this member directly.
+     */
+    size_t limit;
+
     /**
      * @public
      * @brief Current element quantity of this queue.
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
     /**
      * @public
      * @brief Current element capacity of this queue. If `Size` is going to be
@@ -51,7 +111,7 @@ typedef struct {
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Capacity;
+    size_t Capacity;
 } ArrayQueue;
 
 /**
@@ -62,7 +122,7 @@ typedef struct {
  * @param elementSize Element size of `queue`.
  */
 void ArrayQueueConstruct(ArrayQueue *const restrict queue,
-                         const unsigned int initialCapacity,
+                         const size_t initialCapacity,
                          const unsigned long elementSize);
 
 /**
@@ -72,7 +132,7 @@ void ArrayQueueConstruct(ArrayQueue *const restrict queue,
  * @param elementSize Element size of queue.
  * @return LinkedStack* Pointer refering to a heap address.
  */
-ArrayQueue *ArrayQueueNew(const unsigned int initialCapacity,
+ArrayQueue *ArrayQueueNew(const size_t initialCapacity,
                           const unsigned long elementSize);
 
 /**
@@ -90,6 +150,60 @@ void ArrayQueueDestruct(ArrayQueue *const restrict queue);
  */
 void ArrayQueueDelete(ArrayQueue **const restrict queue);
 
+/**
+ * @brief Set the factor by which capacity of `queue` is multiplied when it is
+ * full. It is `2` by default. O(1).
+ *
+ * @param queue `this`.
+ * @param factor Growth factor. It must be greater than `1`.
+ */
+void ArrayQueueSetGrowthFactor(ArrayQueue *const restrict queue,
+                               const double factor);
+
+/**
+ * @brief Enable or disable automatic shrinking of `queue`. When enabled, the
+ * capacity is reduced to `Size` times the growth factor once `Size` falls to
+ * `Capacity` divided by the square of the growth factor, so that alternating
+ * pushes and removals near the boundary don't reallocate repeatedly. It is
+ * disabled by default. O(1).
+ *
+ * @param queue `this`.
+ * @param autoShrink `TRUE` to enable.
+ */
+void ArrayQueueSetAutoShrink(ArrayQueue *const restrict queue,
+                             const Bool autoShrink);
+
+/**
+ * @brief Enable or disable incremental growth of `queue`. When enabled, a full
+ * queue allocates its new storage without copying, and then moves a bounded
+ * number of elements on each following push or pop, so that the migration is
+ * finished before the queue is full again. Pushes and pops stay O(1) in the
+ * worst case, while iterators, `ArrayQueueReserve()` and
+ * `ArrayQueueShrinkToFit()` finish a pending migration first. It is disabled
+ * by default. O(1), or O(n) if disabling it finishes a migration.
+ *
+ * @param queue `this`.
+ * @param incremental `TRUE` to enable.
+ */
+void ArrayQueueSetIncremental(ArrayQueue *const restrict queue,
+                              const Bool incremental);
+
+/**
+ * @brief Make sure that `queue` can hold `capacity` elements without
+ * reallocation. O(n).
+ *
+ * @param queue `this`.
+ * @param capacity Required capacity.
+ */
+void ArrayQueueReserve(ArrayQueue *const restrict queue, const size_t capacity);
+
+/**
+ * @brief Reduce capacity of `queue` to its size, but at least `1`. O(n).
+ *
+ * @param queue `this`.
+ */
+void ArrayQueueShrinkToFit(ArrayQueue *const restrict queue);
+
 /**
  * @brief Get value of the first element in `queue`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
@@ -110,7 +224,8 @@ void ArrayQueuePush(ArrayQueue *const restrict queue,
                     const void *const restrict value);
 
 /**
- * @brief Remove the first element in `queue`. O(n).
+ * @brief Remove the first element in `queue`. Storage is used as a ring, so
+ * no element is moved. O(1).
  *
  * @param queue `this`.
  */
@@ -140,6 +255,32 @@ Bool ArrayQueueSome(ArrayQueue *const restrict queue, TestFunction *const test);
  */
 Bool ArrayQueueAll(ArrayQueue *const restrict queue, TestFunction *const test);
 
+/**
+ * @brief Elements in `queue` will be passed into `test()` in spans of up to
+ * 64 elements. If any bit is returned set, `TRUE` will be returned
+ * immediately. Otherwise, `FALSE` will be returned. O(n).
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool ArrayQueueSomeBatch(ArrayQueue *const restrict queue,
+                         BatchTestFunction *const test);
+
+/**
+ * @brief Elements in `queue` will be passed into `test()` in spans of up to
+ * 64 elements. If any bit is returned clear, `FALSE` will be returned
+ * immediately. Otherwise, `TRUE` will be returned. O(n).
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool ArrayQueueAllBatch(ArrayQueue *const restrict queue,
+                        BatchTestFunction *const test);
+
 /**
  * @brief Get iterator of `queue`. O(1).
  *
@@ -3,9 +3,10 @@
 #include <assert.h>
 #include <malloc.h>
 #include <memory.h>
+#include <stdint.h>
 
 void ArrayStackConstruct(ArrayStack *const restrict stack,
-                         const unsigned int initialCapacity,
+                         const size_t initialCapacity,
                          const unsigned long elementSize) {
     assert(stack != NULL);
     assert(elementSize > 0);
@@ -15,10 +16,12 @@ void ArrayStackConstruct(ArrayStack *const restrict stack,
     assert(stack->array != NULL);
     stack->Capacity = initialCapacity;
     stack->elementSize = elementSize;
+    stack->growthFactor = 2;
+    stack->autoShrink = FALSE;
     stack->Size = 0;
 }
 
-ArrayStack *ArrayStackNew(const unsigned int initialCapacity,
+ArrayStack *ArrayStackNew(const size_t initialCapacity,
                           const unsigned long elementSize) {
     ArrayStack *stack = (ArrayStack *)malloc(sizeof(ArrayStack));
     ArrayStackConstruct(stack, initialCapacity, elementSize);
@@ -42,6 +45,87 @@ void ArrayStackDelete(ArrayStack **const restrict stack) {
     *stack = NULL;
 }
 
+/**
+ * @brief Reallocate storage of `stack` to hold exactly `capacity` elements.
+ * O(n).
+ *
+ * @param stack `this`.
+ * @param capacity New capacity. It must not be less than `stack->Size`.
+ */
+static void __ArrayStackResize(ArrayStack *const restrict stack,
+                               const size_t capacity) {
+    assert(capacity <= SIZE_MAX / stack->elementSize);
+    void *temp = realloc(stack->array, capacity * stack->elementSize);
+    assert(temp != NULL);
+    stack->array = temp;
+    stack->Capacity = capacity;
+}
+
+/**
+ * @brief Make sure that `stack` can hold `size` elements, multiplying its
+ * capacity by the growth factor as many times as needed. O(n).
+ *
+ * @param stack `this`.
+ * @param size Required capacity.
+ */
+static void __ArrayStackReserve(ArrayStack *const restrict stack,
+                                const size_t size) {
+    if (size <= stack->Capacity) return;
+    // Growth stops at the largest capacity whose byte size can be represented.
+    const size_t maximum = SIZE_MAX / stack->elementSize;
+    assert(size <= maximum);
+    size_t capacity = stack->Capacity;
+    while (capacity < size) {
+        const double next = capacity * stack->growthFactor;
+        if (next >= maximum) {
+            capacity = maximum;
+        } else {
+            capacity = next >= capacity + 1 ? next : capacity + 1;
+        }
+    }
+    __ArrayStackResize(stack, capacity);
+}
+
+/**
+ * @brief Reduce capacity of `stack` after removals if automatic shrinking is
+ * enabled and `stack` is sparse enough. O(n) when shrinking, O(1) otherwise.
+ *
+ * @param stack `this`.
+ */
+static void __ArrayStackShrink(ArrayStack *const restrict stack) {
+    if (!stack->autoShrink) return;
+    const double factor = stack->growthFactor;
+    if (stack->Size * factor * factor > stack->Capacity) return;
+    const double target = stack->Size * factor;
+    const size_t capacity = target < 1 ? 1 : target;
+    if (capacity < stack->Capacity) __ArrayStackResize(stack, capacity);
+}
+
+void ArrayStackSetGrowthFactor(ArrayStack *const restrict stack,
+                               const double factor) {
+    assert(stack != NULL);
+    assert(factor > 1);
+    stack->growthFactor = factor;
+}
+
+void ArrayStackSetAutoShrink(ArrayStack *const restrict stack,
+                             const Bool autoShrink) {
+    assert(stack != NULL);
+    stack->autoShrink = autoShrink;
+}
+
+void ArrayStackReserve(ArrayStack *const restrict stack,
+                       const size_t capacity) {
+    assert(stack != NULL);
+    if (capacity > stack->Capacity) __ArrayStackResize(stack, capacity);
+}
+
+void ArrayStackShrinkToFit(ArrayStack *const restrict stack) {
+    assert(stack != NULL);
+    const size_t capacity = stack->Size > 0 ? stack->Size : 1;
+    if (capacity != stack->Capacity) __ArrayStackResize(stack, capacity);
+}
+
 void *ArrayStackTop(const ArrayStack *const restrict stack) {
     assert(stack != NULL);
     assert(stack->Size > 0);
@@ -52,15 +136,7 @@ void ArrayStackPush(ArrayStack *const restrict stack,
                     const void *const restrict value) {
     assert(stack != NULL);
     assert(value != NULL);
-    void *temp = NULL;
-    if (stack->Size == stack->Capacity) {
-        stack->Capacity *= 2;
-        temp = calloc(stack->Capacity, stack->elementSize);
-        assert(temp != NULL);
-        memcpy(temp, stack->array, stack->elementSize * stack->Size);
-        free(stack->array);
-        stack->array = temp;
-    }
+    __ArrayStackReserve(stack, stack->Size + 1);
     memcpy(stack->array + stack->Size * stack->elementSize, value,
            stack->elementSize);
     stack->Size++;
@@ -70,6 +146,7 @@ void ArrayStackPop(ArrayStack *const restrict stack) {
     assert(stack != NULL);
     assert(stack->Size > 0);
     stack->Size--;
+    __ArrayStackShrink(stack);
 }
 
 ArrayStackIterator ArrayStackGetIterator(ArrayStack *const restrict queue) {
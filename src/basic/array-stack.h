@@ -11,8 +11,8 @@
 typedef struct {
     void *array;
     unsigned long elementSize;
-    unsigned int current;
-    unsigned int size;
+    size_t current;
+    size_t size;
 } ArrayStackIterator;
 
 /**
@@ -36,13 +36,28 @@ typedef struct {
      */
     unsigned long elementSize;
 
+    /**
+     * @private
+     * @brief Factor by which capacity is multiplied when this stack is full.
+     * @warning Don't modify this member directly.
+     * @see `ArrayStackSetGrowthFactor()`.
+     */
+    double growthFactor;
+    /**
+     * @private
+     * @brief Whether capacity is reduced automatically after removals.
+     * @warning Don't modify this member directly.
+     * @see `ArrayStackSetAutoShrink()`.
+     */
+    Bool autoShrink;
+
     /**
      * @public
      * @brief Current element quantity of this stack.
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Size;
+    size_t Size;
     /**
      * @public
      * @brief Current element capacity of this stack. If `Size` is going to be
@@ -51,7 +66,7 @@ typedef struct {
      * @attention Don't change value of this member directly. It is maintained
      * automatically.
      */
-    unsigned int Capacity;
+    size_t Capacity;
 } ArrayStack;
 
 /**
@@ -62,7 +77,7 @@ typedef struct {
  * @param elementSize Element size of `stack`.
  */
 void ArrayStackConstruct(ArrayStack *const restrict stack,
-                         const unsigned int initialCapacity,
+                         const size_t initialCapacity,
                          const unsigned long elementSize);
 
 /**
@@ -72,7 +87,7 @@ void ArrayStackConstruct(ArrayStack *const restrict stack,
  * @param elementSize Element size of stack.
  * @return ArrayStack* Pointer refering to a heap address.
  */
-ArrayStack *ArrayStackNew(const unsigned int initialCapacity,
+ArrayStack *ArrayStackNew(const size_t initialCapacity,
                           const unsigned long elementSize);
 
 /**
@@ -90,6 +105,45 @@ void ArrayStackDestruct(ArrayStack *const restrict stack);
  */
 void ArrayStackDelete(ArrayStack **const restrict stack);
 
+/**
+ * @brief Set the factor by which capacity of `stack` is multiplied when it is
+ * full. It is `2` by default. O(1).
+ *
+ * @param stack `this`.
+ * @param factor Growth factor. It must be greater than `1`.
+ */
+void ArrayStackSetGrowthFactor(ArrayStack *const restrict stack,
+                               const double factor);
+
+/**
+ * @brief Enable or disable automatic shrinking of `stack`. When enabled, the
+ * capacity is reduced to `Size` times the growth factor once `Size` falls to
+ * `Capacity` divided by the square of the growth factor, so that alternating
+ * pushes and removals near the boundary don't reallocate repeatedly. It is
+ * disabled by default. O(1).
+ *
+ * @param stack `this`.
+ * @param autoShrink `TRUE` to enable.
+ */
+void ArrayStackSetAutoShrink(ArrayStack *const restrict stack,
+                             const Bool autoShrink);
+
+/**
+ * @brief Make sure that `stack` can hold `capacity` elements without
+ * reallocation. O(n).
+ *
+ * @param stack `this`.
+ * @param capacity Required capacity.
+ */
+void ArrayStackReserve(ArrayStack *const restrict stack, const size_t capacity);
+
+/**
+ * @brief Reduce capacity of `stack` to its size, but at least `1`. O(n).
+ *
+ * @param stack `this`.
+ */
+void ArrayStackShrinkToFit(ArrayStack *const restrict stack);
+
 /**
  * @brief Get value of the element which is on the top of `stack`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
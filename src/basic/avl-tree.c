@@ -4,6 +4,8 @@
 #include <malloc.h>
 #include <memory.h>
 
+#include "batch-test.h"
+
 void AvlTreeNodeConstruct(AvlTreeNode *const restrict node,
                           const void *const restrict value,
                           AvlTreeNode *const restrict parent,
@@ -196,13 +198,13 @@ static void __AvlTreeRebalance(AvlTree *const restrict tree,
                 left = AvlTreeNodeHeight(node->left->left);
                 right = AvlTreeNodeHeight(node->left->right);
 
-                if (right > left) node = __rr(tree, node->left);
+                if (right > left) __rr(tree, node->left);
                 node = __ll(tree, node);
             } else {
                 left = AvlTreeNodeHeight(node->right->left);
                 right = AvlTreeNodeHeight(node->right->right);
 
-                if (left > right) node = __ll(tree, node->left);
+                if (left > right) __ll(tree, node->right);
                 node = __rr(tree, node);
             }
         } else
@@ -410,3 +412,54 @@ Bool AvlTreeAll(AvlTree *const restrict tree, TestFunction *const test) {
 
     return __AvlTreeAll(tree->root, test);
 }
+
+/**
+ * @brief Copy values under `node` into `chunk` in ascending order, passing
+ * every full chunk into the batch test, until a chunk decides the result.
+ * O(n).
+ *
+ * @param node Root of the subtree.
+ * @param chunk Chunk being filled.
+ * @return Bool Whether some chunk decided the result.
+ */
+static Bool __AvlTreeBatch(const AvlTreeNode *const restrict node,
+                           __BatchTestChunk *const restrict chunk) {
+    if (node == NULL) return FALSE;
+    if (__AvlTreeBatch(node->left, chunk)) return TRUE;
+    if (__BatchTestChunkPush(chunk, node->value)) return TRUE;
+    return __AvlTreeBatch(node->right, chunk);
+}
+
+/**
+ * @brief Pass all values of `tree` into `test()` in chunks. O(n).
+ *
+ * @param tree Tree to be tested.
+ * @param test Batch test function.
+ * @param some If `TRUE`, a set bit decides. Otherwise, a clear bit decides.
+ * @return Bool Whether some chunk decided the result.
+ */
+static Bool __AvlTreeBatchAll(AvlTree *const restrict tree,
+                              BatchTestFunction *const test,
+                              const Bool some) {
+    __BatchTestChunk chunk = {malloc(64 * tree->elementSize), 0,
+                              tree->elementSize, test, some};
+    assert(chunk.values != NULL);
+    Bool decided = __AvlTreeBatch(tree->root, &chunk);
+    if (!decided) decided = __BatchTestChunkFlush(&chunk);
+    free(chunk.values);
+    return decided;
+}
+
+Bool AvlTreeSomeBatch(AvlTree *const restrict tree,
+                      BatchTestFunction *const test) {
+    assert(tree != NULL);
+    assert(test != NULL);
+    return __AvlTreeBatchAll(tree, test, TRUE);
+}
+
+Bool AvlTreeAllBatch(AvlTree *const restrict tree,
+                     BatchTestFunction *const test) {
+    assert(tree != NULL);
+    assert(test != NULL);
+    return !__AvlTreeBatchAll(tree, test, FALSE);
+}
@@ -68,7 +68,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } AvlTree;
 
 /**
@@ -211,4 +211,32 @@ Bool AvlTreeSome(AvlTree *const restrict tree, TestFunction *const test);
  */
 Bool AvlTreeAll(AvlTree *const restrict tree, TestFunction *const test);
 
+/**
+ * @brief Values of elements in `tree` will be passed into `test()` in chunks
+ * gathered in ascending order of up to 64 values. If any bit is returned set,
+ * `TRUE` will be returned immediately. Otherwise, `FALSE` will be returned.
+ * O(n).
+ *
+ * @param tree `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool AvlTreeSomeBatch(AvlTree *const restrict tree,
+                      BatchTestFunction *const test);
+
+/**
+ * @brief Values of elements in `tree` will be passed into `test()` in chunks
+ * gathered in ascending order of up to 64 values. If any bit is returned clear,
+ * `FALSE` will be returned immediately. Otherwise, `TRUE` will be returned.
+ * O(n).
+ *
+ * @param tree `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool AvlTreeAllBatch(AvlTree *const restrict tree,
+                     BatchTestFunction *const test);
+
 #endif  // __COLLECTIONS_AVL_TREE__
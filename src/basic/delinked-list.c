@@ -53,6 +53,8 @@ void DelinkedListConstruct(DelinkedList *const restrict list,
     list->tail = NULL;
     list->elementSize = elementSize;
     list->compare = compare;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
     list->Size = 0;
 }
 
@@ -78,6 +80,8 @@ void DelinkedListDestruct(DelinkedList *const restrict list) {
     list->Size = 0;
     list->head = NULL;
     list->tail = NULL;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
 }
 
 void DelinkedListDelete(DelinkedList **const restrict list) {
@@ -88,28 +92,50 @@ void DelinkedListDelete(DelinkedList **const restrict list) {
     *list = NULL;
 }
 
-void *DelinkedListGet(const DelinkedList *const restrict list,
-                      const unsigned int index) {
-    assert(list != NULL);
-    assert(index < list->Size);
+/**
+ * @brief Find the node at `index`, walking from whichever of the first node,
+ * the last node and the cursor is closest. The cursor is moved to the found
+ * node. O(n), or O(1) for neighbours of the last access.
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return DelinkedListNode* The node.
+ */
+static DelinkedListNode *__DelinkedListLocate(
+    DelinkedList *const restrict list, const size_t index) {
     DelinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < index; i++) {
-        node = node->next;
+    size_t i = 0, distance = index;
+    if (list->Size - 1 - index < distance) {
+        node = list->tail;
+        i = list->Size - 1;
+        distance = list->Size - 1 - index;
+    }
+    if (list->cursor != NULL) {
+        const size_t c = list->cursorIndex;
+        if ((c <= index ? index - c : c - index) < distance) {
+            node = list->cursor;
+            i = c;
+        }
     }
-    return node->value;
+    for (; i < index; i++) node = node->next;
+    for (; i > index; i--) node = node->previous;
+    list->cursor = node;
+    list->cursorIndex = index;
+    return node;
+}
+
+void *DelinkedListGet(DelinkedList *const restrict list, const size_t index) {
+    assert(list != NULL);
+    assert(index < list->Size);
+    return __DelinkedListLocate(list, index)->value;
 }
 
-void DelinkedListSet(DelinkedList *const restrict list,
-                     const unsigned int index,
+void DelinkedListSet(DelinkedList *const restrict list, const size_t index,
                      const void *const restrict value) {
     assert(list != NULL);
     assert(index < list->Size);
     assert(value != NULL);
-    DelinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < index; i++) {
-        node = node->next;
-    }
-    memcpy(node->value, value, list->elementSize);
+    memcpy(__DelinkedListLocate(list, index)->value, value, list->elementSize);
 }
 
 void *DelinkedListBack(DelinkedList *const restrict list) {
@@ -148,11 +174,13 @@ void DelinkedListPopBack(DelinkedList *const restrict list) {
         DelinkedListNodeDelete(&list->tail);
         list->head = NULL;
         list->tail = NULL;
+        list->cursor = NULL;
         list->Size = 0;
         return;
     }
 
     node = list->tail;
+    if (list->cursor == node) list->cursor = NULL;
     list->tail = node->previous;
     list->tail->next = NULL;
     DelinkedListNodeDelete(&node);
@@ -172,6 +200,7 @@ void DelinkedListPushFront(DelinkedList *const restrict list,
         list->head->previous = node;
         list->head = node;
     }
+    list->cursorIndex++;
     list->Size++;
 }
 
@@ -183,18 +212,24 @@ void DelinkedListPopFront(DelinkedList *const restrict list) {
         DelinkedListNodeDelete(&list->head);
         list->head = NULL;
         list->tail = NULL;
+        list->cursor = NULL;
         list->Size = 0;
         return;
     }
 
     node = list->head;
+    if (list->cursor == node) {
+        list->cursor = NULL;
+    } else if (list->cursor != NULL) {
+        list->cursorIndex--;
+    }
     list->head = node->next;
     list->head->previous = NULL;
     DelinkedListNodeDelete(&node);
     list->Size--;
 }
 
-void DelinkedListInsert(DelinkedList *const restrict list, const unsigned index,
+void DelinkedListInsert(DelinkedList *const restrict list, const size_t index,
                         const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
@@ -206,24 +241,146 @@ void DelinkedListInsert(DelinkedList *const restrict list, const unsigned index,
         DelinkedListPushBack(list, value);
     else {
         node = DelinkedListNodeNew(value, list->elementSize);
-        temp = list->head;
-        for (unsigned int i = 0; i < index - 1; i++) {
-            temp = temp->next;
-        }
+        temp = __DelinkedListLocate(list, index - 1);
         node->next = temp->next;
         temp->next->previous = node;
         temp->next = node;
         node->previous = temp;
+        list->cursor = node;
+        list->cursorIndex = index;
         list->Size++;
     }
 }
 
-int DelinkedListFind(DelinkedList *const restrict list,
-                     const void *const restrict value) {
+/**
+ * @brief Link the detached chain of nodes from `first` to `last` (both
+ * contained) before `position`. O(1).
+ *
+ * @param list `this`.
+ * @param position Node before which the chain is linked. If `NULL`, the chain
+ * is linked at the end of `list`.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ */
+static void __DelinkedListLink(DelinkedList *const restrict list,
+                               DelinkedListNode *const position,
+                               DelinkedListNode *const first,
+                               DelinkedListNode *const last) {
+    DelinkedListNode *previous =
+        position != NULL ? position->previous : list->tail;
+    first->previous = previous;
+    last->next = position;
+    if (previous != NULL) {
+        previous->next = first;
+    } else {
+        list->head = first;
+    }
+    if (position != NULL) {
+        position->previous = last;
+    } else {
+        list->tail = last;
+    }
+}
+
+/**
+ * @brief Detach nodes from `first` to `last` (both contained) from `list`,
+ * leaving their own links untouched. O(1).
+ *
+ * @param list `this`.
+ * @param first The first node of the chain.
+ * @param last The last node of the chain.
+ */
+static void __DelinkedListUnlink(DelinkedList *const restrict list,
+                                 DelinkedListNode *const first,
+                                 DelinkedListNode *const last) {
+    if (first->previous != NULL) {
+        first->previous->next = last->next;
+    } else {
+        list->head = last->next;
+    }
+    if (last->next != NULL) {
+        last->next->previous = first->previous;
+    } else {
+        list->tail = first->previous;
+    }
+}
+
+DelinkedListIterator DelinkedListInsertAfter(
+    DelinkedList *const restrict list, DelinkedListIterator const iterator,
+    const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    DelinkedListNode *node = DelinkedListNodeNew(value, list->elementSize);
+    __DelinkedListLink(list, iterator != NULL ? iterator->next : list->head,
+                       node, node);
+    list->cursor = NULL;
+    list->Size++;
+    return node;
+}
+
+DelinkedListIterator DelinkedListInsertBefore(
+    DelinkedList *const restrict list, DelinkedListIterator const iterator,
+    const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    DelinkedListNode *node = DelinkedListNodeNew(value, list->elementSize);
+    __DelinkedListLink(list, iterator, node, node);
+    list->cursor = NULL;
+    list->Size++;
+    return node;
+}
+
+DelinkedListIterator DelinkedListErase(DelinkedList *const restrict list,
+                                       DelinkedListIterator const iterator) {
+    assert(list != NULL);
+    assert(iterator != NULL);
+    assert(list->Size > 0);
+    DelinkedListNode *node = iterator, *next = iterator->next;
+    __DelinkedListUnlink(list, node, node);
+    DelinkedListNodeDelete(&node);
+    list->cursor = NULL;
+    list->Size--;
+    return next;
+}
+
+void DelinkedListSplice(DelinkedList *const list,
+                        DelinkedListIterator const position,
+                        DelinkedList *const other,
+                        DelinkedListIterator const first,
+                        DelinkedListIterator const last) {
+    assert(list != NULL);
+    assert(other != NULL);
+    assert(list->elementSize == other->elementSize);
+    if (first == last) return;
+    assert(first != NULL);
+    // Moving a range of `list` next to itself changes nothing.
+    if (position == first || (position == last && position != NULL)) return;
+    DelinkedListNode *end = last != NULL ? last->previous : other->tail;
+    size_t count = 0;
+    if (list != other) {
+        if (first == other->head && last == NULL) {
+            count = other->Size;
+        } else {
+            for (DelinkedListNode *node = first; node != last;
+                 node = node->next) {
+                count++;
+            }
+        }
+    }
+    __DelinkedListUnlink(other, first, end);
+    __DelinkedListLink(list, position, first, end);
+    list->cursor = NULL;
+    other->cursor = NULL;
+    list->Size += count;
+    other->Size -= count;
+}
+
+size_t DelinkedListFind(DelinkedList *const restrict list,
+                        const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
     DelinkedListNode *node = list->head;
-    for (int i = 0; i < list->Size; i++) {
+    for (size_t i = 0; i < list->Size; i++) {
         if (list->compare(node->value, value) == 0) return i;
         node = node->next;
     }
@@ -231,17 +388,13 @@ int DelinkedListFind(DelinkedList *const restrict list,
 }
 
 DelinkedList *DelinkedListSlice(DelinkedList *const restrict list,
-                                const unsigned int start,
-                                const unsigned int size) {
+                                const size_t start, const size_t size) {
     assert(list != NULL);
     assert(start < list->Size);
     assert(size > 0);
     DelinkedList *slice = DelinkedListNew(list->elementSize, list->compare);
-    DelinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < start; i++) {
-        node = node->next;
-    }
-    for (unsigned int i = 0; i < size; i++) {
+    DelinkedListNode *node = __DelinkedListLocate(list, start);
+    for (size_t i = 0; i < size; i++) {
         DelinkedListPushBack(slice, node->value);
         node = node->next;
     }
@@ -296,12 +449,65 @@ static void __QuickSort(DelinkedList *const restrict list,
 
 void DelinkedListQuickSort(DelinkedList *const restrict list) {
     assert(list != NULL);
+    if (list->Size < 2) return;
     void *cache = malloc(list->elementSize);
     assert(cache != NULL);
     __QuickSort(list, list->head, list->tail, cache);
     free(cache);
 }
 
+/**
+ * @brief Bottom-up merge sort algorithm. Relink nodes of `list` in
+ * ascending order, keeping the order of equal elements. O(nlog₂n).
+ *
+ * @param list List to be sorted.
+ */
+static void __MergeSort(DelinkedList *const restrict list) {
+    for (unsigned long width = 1; width < list->Size; width *= 2) {
+        DelinkedListNode *left = list->head, *head = NULL, *tail = NULL;
+        while (left != NULL) {
+            DelinkedListNode *right = left;
+            unsigned long leftSize = 0, rightSize = width;
+            while (leftSize < width && right != NULL) {
+                leftSize++;
+                right = right->next;
+            }
+            while (leftSize > 0 || (rightSize > 0 && right != NULL)) {
+                DelinkedListNode *element = NULL;
+                if (leftSize == 0 ||
+                    (rightSize > 0 && right != NULL &&
+                     list->compare(right->value, left->value) < 0)) {
+                    element = right;
+                    right = right->next;
+                    rightSize--;
+                } else {
+                    element = left;
+                    left = left->next;
+                    leftSize--;
+                }
+                if (tail == NULL) {
+                    head = element;
+                } else {
+                    tail->next = element;
+                }
+                element->previous = tail;
+                tail = element;
+            }
+            left = right;
+        }
+        head->previous = NULL;
+        tail->next = NULL;
+        list->head = head;
+        list->tail = tail;
+    }
+}
+
+void DelinkedListMergeSort(DelinkedList *const restrict list) {
+    assert(list != NULL);
+    list->cursor = NULL;
+    __MergeSort(list);
+}
+
 DelinkedListIterator DelinkedListGetIterator(
     DelinkedList *const restrict list) {
     assert(list != NULL);
@@ -70,6 +70,20 @@ typedef struct {
      * @warning Don't modify this member directly.
      */
     CompareFunction *compare;
+    /**
+     * @private
+     * @brief Node which was accessed by index last time, or `NULL` if there is
+     * none. Indexed accesses walk from whichever of `head`, `tail` and this
+     * node is closest.
+     * @warning Don't modify this member directly.
+     */
+    DelinkedListNode *cursor;
+    /**
+     * @private
+     * @brief Index of `cursor`.
+     * @warning Don't modify this member directly.
+     */
+    size_t cursorIndex;
 
     /**
      * @public
@@ -77,7 +91,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } DelinkedList;
 
 /**
@@ -154,26 +168,30 @@ void DelinkedListDestruct(DelinkedList *const restrict list);
 void DelinkedListDelete(DelinkedList **const restrict list);
 
 /**
- * @brief Get value of the element at specified `index`. O(n).
+ * @brief Get value of the element at specified `index`. The node is reached
+ * from the closest of the first node, the last node and the node accessed by
+ * index last time. O(n), or O(1) for neighbours of the last access.
  * @attention The returned value is shallow copied. Don't free it.
+ * @warning It updates the cached position of `list`, so it must not run
+ * concurrently with other calls on `list`.
  *
  * @param list `this`.
  * @param index Specified index.
  * @return void* If successful, the element will be returned. Otherwise, `NULL`
  * will be returned.
  */
-void *DelinkedListGet(const DelinkedList *const restrict list,
-                      const unsigned int index);
+void *DelinkedListGet(DelinkedList *const restrict list, const size_t index);
 
 /**
- * @brief Set value of element at specified `index`. O(n).
+ * @brief Set value of element at specified `index`. O(n), or O(1) for
+ * neighbours of the last access.
+ * @see `DelinkedListGet()`.
  *
  * @param list `this`.
  * @param index Specified index.
  * @param value Value of element. It will be DEEP copied.
  */
-void DelinkedListSet(DelinkedList *const restrict list,
-                     const unsigned int index,
+void DelinkedListSet(DelinkedList *const restrict list, const size_t index,
                      const void *const restrict value);
 
 /**
@@ -228,25 +246,84 @@ void DelinkedListPopFront(DelinkedList *const restrict list);
 
 /**
  * @brief Add new element at the specified index of `list`. After element
- * added, `list[index]` will be the new element. O(n).
+ * added, `list[index]` will be the new element. O(n), or O(1) for
+ * neighbours of the last access.
+ * @see `DelinkedListGet()`.
  *
  * @param list `this`.
  * @param value Value of element. It will be DEEP copied.
  */
-void DelinkedListInsert(DelinkedList *const restrict list,
-                        const unsigned int index,
+void DelinkedListInsert(DelinkedList *const restrict list, const size_t index,
                         const void *const restrict value);
 
+/**
+ * @brief Add new element after the element of `iterator`. O(1).
+ *
+ * @param list `this`.
+ * @param iterator Iterator of an element in `list`. If it is ended, the new
+ * element is added at the begin of `list`.
+ * @param value Value of element. It will be DEEP copied.
+ * @return DelinkedListIterator Iterator of the new element.
+ */
+DelinkedListIterator DelinkedListInsertAfter(
+    DelinkedList *const restrict list, DelinkedListIterator const iterator,
+    const void *const restrict value);
+
+/**
+ * @brief Add new element before the element of `iterator`. O(1).
+ *
+ * @param list `this`.
+ * @param iterator Iterator of an element in `list`. If it is ended, the new
+ * element is added at the end of `list`.
+ * @param value Value of element. It will be DEEP copied.
+ * @return DelinkedListIterator Iterator of the new element.
+ */
+DelinkedListIterator DelinkedListInsertBefore(
+    DelinkedList *const restrict list, DelinkedListIterator const iterator,
+    const void *const restrict value);
+
+/**
+ * @brief Remove the element of `iterator` from `list`. Other iterators stay
+ * valid. O(1).
+ *
+ * @param list `this`.
+ * @param iterator Iterator of an element in `list`. It is invalidated.
+ * @return DelinkedListIterator Iterator of the element after the removed one.
+ */
+DelinkedListIterator DelinkedListErase(DelinkedList *const restrict list,
+                                       DelinkedListIterator const iterator);
+
+/**
+ * @brief Move elements from `first` (contained) to `last` (not contained) of
+ * `other` before the element of `position` in `list`. Nodes are relinked, so
+ * values are not copied and iterators of the moved elements stay valid. O(1)
+ * if `other` is `list` or the whole of `other` is moved, otherwise O(k) to
+ * count the k moved elements.
+ *
+ * @param list `this`.
+ * @param position Iterator of an element in `list`. If it is ended, elements
+ * are moved to the end of `list`. It must not be one of the moved elements.
+ * @param other List which contains the moved elements. It can be `list`.
+ * @param first Iterator of the first moved element in `other`.
+ * @param last Iterator of the element after the last moved one in `other`. If
+ * it is ended, elements until the end of `other` are moved.
+ */
+void DelinkedListSplice(DelinkedList *const list,
+                        DelinkedListIterator const position,
+                        DelinkedList *const other,
+                        DelinkedListIterator const first,
+                        DelinkedListIterator const last);
+
 /**
  * @brief Find the element which has `value`. O(n).
  *
  * @param list `this`.
  * @param value Specified value.
- * @return int If found, the index of the element will be returned. If not
- * found, `-1` will be returned.
+ * @return size_t If found, the index of the element will be returned. If not
+ * found, `(size_t)-1` will be returned.
  */
-int DelinkedListFind(DelinkedList *const restrict list,
-                     const void *const restrict value);
+size_t DelinkedListFind(DelinkedList *const restrict list,
+                        const void *const restrict value);
 
 /**
  * @brief Slice `list`, and return new list which contains DEEP copied
@@ -259,8 +336,7 @@ int DelinkedListFind(DelinkedList *const restrict list,
  * NOT automatically be released.
  */
 DelinkedList *DelinkedListSlice(DelinkedList *const restrict list,
-                                const unsigned int start,
-                                const unsigned int size);
+                                const size_t start, const size_t size);
 
 /**
  * @brief Use quick sort algorithm to sort `list`. O(nlog₂n).
@@ -269,6 +345,15 @@ DelinkedList *DelinkedListSlice(DelinkedList *const restrict list,
  */
 void DelinkedListQuickSort(DelinkedList *const restrict list);
 
+/**
+ * @brief Use merge sort algorithm to sort `list`. Nodes are relinked instead
+ * of copying values, so no extra memory is needed and equal elements keep
+ * their order. O(nlog₂n).
+ *
+ * @param list `this`.
+ */
+void DelinkedListMergeSort(DelinkedList *const restrict list);
+
 /**
  * @brief Get iterator of `list`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
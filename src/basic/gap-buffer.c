@@ -0,0 +1,188 @@
+#include "gap-buffer.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+#include <stdint.h>
+
+void GapBufferConstruct(GapBuffer *const restrict buffer,
+                        const size_t initialCapacity,
+                        const unsigned long elementSize) {
+    assert(buffer != NULL);
+    assert(initialCapacity > 0);
+    assert(elementSize > 0);
+
+    buffer->array = calloc(initialCapacity, elementSize);
+    assert(buffer->array != NULL);
+    buffer->elementSize = elementSize;
+    buffer->Cursor = 0;
+    buffer->Size = 0;
+    buffer->Capacity = initialCapacity;
+}
+
+GapBuffer *GapBufferNew(const size_t initialCapacity,
+                        const unsigned long elementSize) {
+    GapBuffer *buffer = (GapBuffer *)malloc(sizeof(GapBuffer));
+    GapBufferConstruct(buffer, initialCapacity, elementSize);
+    return buffer;
+}
+
+void GapBufferDestruct(GapBuffer *const restrict buffer) {
+    if (buffer == NULL) return;
+    free(buffer->array);
+    buffer->array = NULL;
+    buffer->elementSize = 0;
+    buffer->Cursor = 0;
+    buffer->Size = 0;
+    buffer->Capacity = 0;
+}
+
+void GapBufferDelete(GapBuffer **const restrict buffer) {
+    if (buffer == NULL) return;
+    GapBufferDestruct(*buffer);
+    free(*buffer);
+    *buffer = NULL;
+}
+
+/**
+ * @brief Enlarge storage of `buffer` to hold exactly `capacity` elements.
+ * Elements after the cursor are moved to the new end, so the gap grows. O(n).
+ *
+ * @param buffer `this`.
+ * @param capacity New capacity. It must be greater than `buffer->Capacity`.
+ */
+static void __GapBufferResize(GapBuffer *const restrict buffer,
+                              const size_t capacity) {
+    assert(capacity <= SIZE_MAX / buffer->elementSize);
+    const size_t tail = buffer->Size - buffer->Cursor;
+    void *temp = realloc(buffer->array, capacity * buffer->elementSize);
+    assert(temp != NULL);
+    memmove(temp + (capacity - tail) * buffer->elementSize,
+            temp + (buffer->Capacity - tail) * buffer->elementSize,
+            tail * buffer->elementSize);
+    buffer->array = temp;
+    buffer->Capacity = capacity;
+}
+
+/**
+ * @brief Make sure that `buffer` can hold `size` elements, doubling its
+ * capacity as many times as needed. O(n).
+ *
+ * @param buffer `this`.
+ * @param size Required capacity.
+ */
+static void __GapBufferReserve(GapBuffer *const restrict buffer,
+                               const size_t size) {
+    if (size <= buffer->Capacity) return;
+    const size_t maximum = SIZE_MAX / buffer->elementSize;
+    assert(size <= maximum);
+    size_t capacity = buffer->Capacity;
+    while (capacity < size) {
+        capacity = capacity > maximum / 2 ? maximum : capacity * 2;
+    }
+    __GapBufferResize(buffer, capacity);
+}
+
+void GapBufferReserve(GapBuffer *const restrict buffer, const size_t capacity) {
+    assert(buffer != NULL);
+    if (capacity > buffer->Capacity) __GapBufferResize(buffer, capacity);
+}
+
+void *GapBufferGet(const GapBuffer *const restrict buffer, const size_t index) {
+    assert(buffer != NULL);
+    assert(index < buffer->Size);
+    if (index < buffer->Cursor) {
+        return buffer->array + index * buffer->elementSize;
+    }
+    return buffer->array +
+           (index + buffer->Capacity - buffer->Size) * buffer->elementSize;
+}
+
+void GapBufferSet(GapBuffer *const restrict buffer, const size_t index,
+                  const void *const restrict value) {
+    assert(value != NULL);
+    memcpy(GapBufferGet(buffer, index), value, buffer->elementSize);
+}
+
+void GapBufferMoveCursor(GapBuffer *const restrict buffer, const size_t index) {
+    assert(buffer != NULL);
+    assert(index <= buffer->Size);
+    const size_t gap = buffer->Capacity - buffer->Size;
+    if (index < buffer->Cursor) {
+        // Elements in [index, Cursor) move to the end of the gap.
+        memmove(buffer->array + (index + gap) * buffer->elementSize,
+                buffer->array + index * buffer->elementSize,
+                (buffer->Cursor - index) * buffer->elementSize);
+    } else if (index > buffer->Cursor) {
+        // Elements in [Cursor, index) move to the beginning of the gap.
+        memmove(buffer->array + buffer->Cursor * buffer->elementSize,
+                buffer->array + (buffer->Cursor + gap) * buffer->elementSize,
+                (index - buffer->Cursor) * buffer->elementSize);
+    }
+    buffer->Cursor = index;
+}
+
+void GapBufferInsert(GapBuffer *const restrict buffer,
+                     const void *const restrict value) {
+    assert(buffer != NULL);
+    assert(value != NULL);
+    __GapBufferReserve(buffer, buffer->Size + 1);
+    memcpy(buffer->array + buffer->Cursor * buffer->elementSize, value,
+           buffer->elementSize);
+    buffer->Cursor++;
+    buffer->Size++;
+}
+
+void GapBufferInsertRange(GapBuffer *const restrict buffer,
+                          const void *const restrict values,
+                          const size_t count) {
+    assert(buffer != NULL);
+    assert(values != NULL || count == 0);
+    if (count == 0) return;
+    assert(count <= SIZE_MAX - buffer->Size);
+    __GapBufferReserve(buffer, buffer->Size + count);
+    memcpy(buffer->array + buffer->Cursor * buffer->elementSize, values,
+           count * buffer->elementSize);
+    buffer->Cursor += count;
+    buffer->Size += count;
+}
+
+void GapBufferErase(GapBuffer *const restrict buffer, const size_t count) {
+    assert(buffer != NULL);
+    assert(count <= buffer->Size - buffer->Cursor);
+    buffer->Size -= count;
+}
+
+void GapBufferEraseBefore(GapBuffer *const restrict buffer,
+                          const size_t count) {
+    assert(buffer != NULL);
+    assert(count <= buffer->Cursor);
+    // Elements after the cursor stay at the end of the array, so only the
+    // beginning of the gap moves.
+    buffer->Cursor -= count;
+    buffer->Size -= count;
+}
+
+void GapBufferInsertAt(GapBuffer *const restrict buffer, const size_t index,
+                       const void *const restrict value) {
+    GapBufferMoveCursor(buffer, index);
+    GapBufferInsert(buffer, value);
+}
+
+void GapBufferEraseAt(GapBuffer *const restrict buffer, const size_t index,
+                      const size_t count) {
+    GapBufferMoveCursor(buffer, index);
+    GapBufferErase(buffer, count);
+}
+
+void GapBufferCopyTo(const GapBuffer *const restrict buffer,
+                     void *const restrict output) {
+    assert(buffer != NULL);
+    assert(output != NULL);
+    memcpy(output, buffer->array, buffer->Cursor * buffer->elementSize);
+    memcpy(output + buffer->Cursor * buffer->elementSize,
+           buffer->array +
+               (buffer->Cursor + buffer->Capacity - buffer->Size) *
+                   buffer->elementSize,
+           (buffer->Size - buffer->Cursor) * buffer->elementSize);
+}
@@ -0,0 +1,206 @@
+#ifndef __COLLECTIONS_GAP_BUFFER__
+#define __COLLECTIONS_GAP_BUFFER__
+
+#include "types.h"
+
+/**
+ * @brief An array with a movable gap of unused slots at the cursor. Elements
+ * before the cursor are stored at the beginning of the array and elements
+ * after it at the end, so insertions and removals at the cursor don't move
+ * other elements. Moving the cursor moves only the elements it passes.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `GapBufferConstruct()`, `GapBufferNew()`, `GapBufferDestruct()`,
+ * `GapBufferDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief All elements will be stored in this member, with the gap between
+     * `Cursor` and `Cursor + Capacity - Size`.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `GapBufferGet()`, `GapBufferInsert()`, `GapBufferErase()`.
+     */
+    void *array;
+    /**
+     * @private
+     * @brief Element size of this buffer.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+
+    /**
+     * @public
+     * @brief Index where elements are inserted and removed. Elements before it
+     * are not moved by insertions or removals.
+     * @attention Don't change value of this member directly. Please use
+     * `GapBufferMoveCursor()`.
+     */
+    size_t Cursor;
+    /**
+     * @public
+     * @brief Current element quantity of this buffer.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Size;
+    /**
+     * @public
+     * @brief Current element capacity of this buffer. If `Size` is going to be
+     * larger than `Capacity`, this buffer will automatically expand its
+     * capacity.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Capacity;
+} GapBuffer;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param buffer Target to be constructed.
+ * @param initialCapacity Initial capacity of `buffer`.
+ * @param elementSize Element size of `buffer`.
+ */
+void GapBufferConstruct(GapBuffer *const restrict buffer,
+                        const size_t initialCapacity,
+                        const unsigned long elementSize);
+
+/**
+ * @brief Allocate a new buffer in heap. O(1).
+ *
+ * @param initialCapacity Initial capacity of buffer.
+ * @param elementSize Element size of buffer.
+ * @return GapBuffer* Pointer refering to a heap address.
+ */
+GapBuffer *GapBufferNew(const size_t initialCapacity,
+                        const unsigned long elementSize);
+
+/**
+ * @brief Destruct function. O(1).
+ *
+ * @param buffer Target to be destructed. If `NULL`, nothing will happen.
+ */
+void GapBufferDestruct(GapBuffer *const restrict buffer);
+
+/**
+ * @brief Release `buffer` in heap. O(1).
+ *
+ * @param buffer Pointer refers to the target which is to be deleted. The
+ * target will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void GapBufferDelete(GapBuffer **const restrict buffer);
+
+/**
+ * @brief Make sure that `buffer` can hold `capacity` elements without
+ * reallocation. O(n).
+ *
+ * @param buffer `this`.
+ * @param capacity Required capacity.
+ */
+void GapBufferReserve(GapBuffer *const restrict buffer, const size_t capacity);
+
+/**
+ * @brief Get element at `index`. O(1).
+ * @attention The returned value is shallow copied. Don't free it. It is
+ * invalidated once the cursor passes it or `buffer` grows.
+ *
+ * @param buffer `this`.
+ * @param index Specified index.
+ * @return void* Value of element.
+ */
+void *GapBufferGet(const GapBuffer *const restrict buffer, const size_t index);
+
+/**
+ * @brief Set element at `index`. O(1).
+ *
+ * @param buffer `this`.
+ * @param index Specified index.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void GapBufferSet(GapBuffer *const restrict buffer, const size_t index,
+                  const void *const restrict value);
+
+/**
+ * @brief Move the cursor of `buffer` to `index`. Elements between the old and
+ * the new cursor are moved across the gap. O(|index - Cursor|).
+ *
+ * @param buffer `this`.
+ * @param index New cursor. It must not be greater than `Size`.
+ */
+void GapBufferMoveCursor(GapBuffer *const restrict buffer, const size_t index);
+
+/**
+ * @brief Add new element at the cursor of `buffer`, and move the cursor after
+ * it. Amortized O(1).
+ *
+ * @param buffer `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void GapBufferInsert(GapBuffer *const restrict buffer,
+                     const void *const restrict value);
+
+/**
+ * @brief Add `count` new elements at the cursor of `buffer`, and move the
+ * cursor after them. Amortized O(count).
+ *
+ * @param buffer `this`.
+ * @param values Pointer refers to `count` contiguous values. They will be DEEP
+ * copied.
+ * @param count Value count.
+ */
+void GapBufferInsertRange(GapBuffer *const restrict buffer,
+                          const void *const restrict values,
+                          const size_t count);
+
+/**
+ * @brief Remove `count` elements after the cursor of `buffer`. O(1).
+ *
+ * @param buffer `this`.
+ * @param count Element count.
+ */
+void GapBufferErase(GapBuffer *const restrict buffer, const size_t count);
+
+/**
+ * @brief Remove `count` elements before the cursor of `buffer`, and move the
+ * cursor back by `count`. O(1).
+ *
+ * @param buffer `this`.
+ * @param count Element count.
+ */
+void GapBufferEraseBefore(GapBuffer *const restrict buffer, const size_t count);
+
+/**
+ * @brief Add new element at `index` of `buffer`. It equals to
+ * `GapBufferMoveCursor()` followed by `GapBufferInsert()`.
+ * O(|index - Cursor|).
+ *
+ * @param buffer `this`.
+ * @param index Specified index.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void GapBufferInsertAt(GapBuffer *const restrict buffer, const size_t index,
+                       const void *const restrict value);
+
+/**
+ * @brief Remove `count` elements from `index` of `buffer`. It equals to
+ * `GapBufferMoveCursor()` followed by `GapBufferErase()`.
+ * O(|index - Cursor|).
+ *
+ * @param buffer `this`.
+ * @param index Index of the first removed element.
+ * @param count Element count.
+ */
+void GapBufferEraseAt(GapBuffer *const restrict buffer, const size_t index,
+                      const size_t count);
+
+/**
+ * @brief Copy all elements of `buffer` in order into `output`. O(n).
+ *
+ * @param buffer `this`.
+ * @param output Pointer refers to memory which can hold `Size` values.
+ */
+void GapBufferCopyTo(const GapBuffer *const restrict buffer,
+                     void *const restrict output);
+
+#endif  // __COLLECTIONS_GAP_BUFFER__
@@ -50,6 +50,8 @@ void LinkedListConstruct(LinkedList *const restrict list,
     list->tail = NULL;
     list->elementSize = elementSize;
     list->compare = compare;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
     list->Size = 0;
 }
 
@@ -75,6 +77,8 @@ void LinkedListDestruct(LinkedList *const restrict list) {
     list->Size = 0;
     list->head = NULL;
     list->tail = NULL;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
 }
 
 void LinkedListDelete(LinkedList **const restrict list) {
@@ -85,27 +89,44 @@ void LinkedListDelete(LinkedList **const restrict list) {
     *list = NULL;
 }
 
-void *LinkedListGet(const LinkedList *const restrict list,
-                    const unsigned int index) {
-    assert(list != NULL);
-    assert(index < list->Size);
+/**
+ * @brief Find the node at `index`, walking from the cursor if it is not after
+ * `index`, or else from the first node. The cursor is moved to the found node.
+ * O(n), or O(1) for the next index of the last access.
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return LinkedListNode* The node.
+ */
+static LinkedListNode *__LinkedListLocate(LinkedList *const restrict list,
+                                          const size_t index) {
+    if (index == list->Size - 1) return list->tail;
     LinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < index; i++) {
+    size_t i = 0;
+    if (list->cursor != NULL && list->cursorIndex <= index) {
+        node = list->cursor;
+        i = list->cursorIndex;
+    }
+    for (; i < index; i++) {
         node = node->next;
     }
-    return node->value;
+    list->cursor = node;
+    list->cursorIndex = index;
+    return node;
+}
+
+void *LinkedListGet(LinkedList *const restrict list, const size_t index) {
+    assert(list != NULL);
+    assert(index < list->Size);
+    return __LinkedListLocate(list, index)->value;
 }
 
-void LinkedListSet(LinkedList *const restrict list, const unsigned int index,
+void LinkedListSet(LinkedList *const restrict list, const size_t index,
                    const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
     assert(index < list->Size);
-    LinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < index; i++) {
-        node = node->next;
-    }
-    memcpy(node->value, value, list->elementSize);
+    memcpy(__LinkedListLocate(list, index)->value, value, list->elementSize);
 }
 
 void *LinkedListBack(LinkedList *const restrict list) {
@@ -143,15 +164,15 @@ void LinkedListPopBack(LinkedList *const restrict list) {
         LinkedListNodeDelete(&list->tail);
         list->head = NULL;
         list->tail = NULL;
+        list->cursor = NULL;
         list->Size = 0;
         return;
     }
 
-    node = list->head;
-    while (node->next != list->tail) {
-        node = node->next;
-    }
+    if (list->cursor == list->tail) list->cursor = NULL;
+    node = __LinkedListLocate(list, list->Size - 2);
     LinkedListNodeDelete(&list->tail);
+    node->next = NULL;
     list->tail = node;
     list->Size--;
 }
@@ -168,6 +189,7 @@ void LinkedListPushFront(LinkedList *const restrict list,
         node->next = list->head;
         list->head = node;
     }
+    list->cursorIndex++;
     list->Size++;
 }
 
@@ -176,12 +198,17 @@ void LinkedListPopFront(LinkedList *const restrict list) {
     assert(list->Size > 0);
     LinkedListNode *node = list->head;
     list->head = node->next;
+    if (list->cursor == node) {
+        list->cursor = NULL;
+    } else if (list->cursor != NULL) {
+        list->cursorIndex--;
+    }
     LinkedListNodeDelete(&node);
     if (list->Size == 1) list->tail = NULL;
     list->Size--;
 }
 
-void LinkedListInsert(LinkedList *const restrict list, const unsigned index,
+void LinkedListInsert(LinkedList *const restrict list, const size_t index,
                       const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
@@ -193,45 +220,91 @@ void LinkedListInsert(LinkedList *const restrict list, const unsigned index,
         LinkedListPushBack(list, value);
     else {
         node = LinkedListNodeNew(value, list->elementSize);
-        temp = list->head;
-        for (unsigned int i = 0; i < index - 1; i++) {
-            temp = temp->next;
-        }
+        temp = __LinkedListLocate(list, index - 1);
         node->next = temp->next;
         temp->next = node;
+        list->cursor = node;
+        list->cursorIndex = index;
         list->Size++;
     }
 }
 
-int LinkedListFind(LinkedList *const restrict list,
-                   const void *const restrict value) {
+size_t LinkedListFind(LinkedList *const restrict list,
+                      const void *const restrict value) {
     assert(list != NULL);
     assert(value != NULL);
     LinkedListNode *node = list->head;
-    for (int i = 0; i < list->Size; i++) {
+    for (size_t i = 0; i < list->Size; i++) {
         if (list->compare(node->value, value) == 0) return i;
         node = node->next;
     }
     return -1;
 }
 
-LinkedList *LinkedListSlice(LinkedList *const restrict list,
-                            const unsigned int start, const unsigned int size) {
+LinkedList *LinkedListSlice(LinkedList *const restrict list, const size_t start,
+                            const size_t size) {
     assert(list != NULL);
     assert(start < list->Size);
     assert(size > 0);
     LinkedList *slice = LinkedListNew(list->elementSize, list->compare);
-    LinkedListNode *node = list->head;
-    for (unsigned int i = 0; i < start; i++) {
-        node = node->next;
-    }
-    for (unsigned int i = 0; i < size; i++) {
+    LinkedListNode *node = __LinkedListLocate(list, start);
+    for (size_t i = 0; i < size; i++) {
         LinkedListPushBack(slice, node->value);
         node = node->next;
     }
     return slice;
 }
 
+/**
+ * @brief Bottom-up merge sort algorithm. Relink nodes of `list` in
+ * ascending order, keeping the order of equal elements. O(nlog₂n).
+ *
+ * @param list List to be sorted.
+ */
+static void __MergeSort(LinkedList *const restrict list) {
+    for (unsigned long width = 1; width < list->Size; width *= 2) {
+        LinkedListNode *left = list->head, *head = NULL, *tail = NULL;
+        while (left != NULL) {
+            LinkedListNode *right = left;
+            unsigned long leftSize = 0, rightSize = width;
+            while (leftSize < width && right != NULL) {
+                leftSize++;
+                right = right->next;
+            }
+            while (leftSize > 0 || (rightSize > 0 && right != NULL)) {
+                LinkedListNode *element = NULL;
+                if (leftSize == 0 ||
+                    (rightSize > 0 && right != NULL &&
+                     list->compare(right->value, left->value) < 0)) {
+                    element = right;
+                    right = right->next;
+                    rightSize--;
+                } else {
+                    element = left;
+                    left = left->next;
+                    leftSize--;
+                }
+                if (tail == NULL) {
+                    head = element;
+                } else {
+                    tail->next = element;
+                }
+                tail = element;
+            }
+            left = right;
+        }
+        tail->next = NULL;
+        list->head = head;
+        list->tail = tail;
+    }
+}
+
+void LinkedListMergeSort(LinkedList *const restrict list) {
+    assert(list != NULL);
+    list->cursor = NULL;
+    __MergeSort(list);
+}
+
 LinkedListIterator LinkedListGetIterator(LinkedList *const restrict list) {
     assert(list != NULL);
     return list->head;
@@ -64,6 +64,19 @@ typedef struct {
      * @warning Don't modify this member directly.
      */
     CompareFunction *compare;
+    /**
+     * @private
+     * @brief Node which was accessed by index last time, or `NULL` if there is
+     * none. Indexed accesses at or after it walk from here instead of `head`.
+     * @warning Don't modify this member directly.
+     */
+    LinkedListNode *cursor;
+    /**
+     * @private
+     * @brief Index of `cursor`.
+     * @warning Don't modify this member directly.
+     */
+    size_t cursorIndex;
 
     /**
      * @public
@@ -71,7 +84,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } LinkedList;
 
 /**
@@ -148,25 +161,31 @@ void LinkedListDestruct(LinkedList *const restrict list);
 void LinkedListDelete(LinkedList **const restrict list);
 
 /**
- * @brief Get value of the element at specified `index`. O(n).
+ * @brief Get value of the element at specified `index`. The node is reached
+ * from the node accessed by index last time if it is not after `index`, or
+ * else from the first node. O(n), or O(1) for the next index of the last
+ * access.
  * @attention The returned value is shallow copied. Don't free it.
+ * @warning It updates the cached position of `list`, so it must not run
+ * concurrently with other calls on `list`.
  *
  * @param list `this`.
  * @param index Specified index.
  * @return void* If successful, the element will be returned. Otherwise, `NULL`
  * will be returned.
  */
-void *LinkedListGet(const LinkedList *const restrict list,
-                    const unsigned int index);
+void *LinkedListGet(LinkedList *const restrict list, const size_t index);
 
 /**
- * @brief Set value of element at specified `index`. O(n).
+ * @brief Set value of element at specified `index`. O(n), or O(1) for the next
+ * index of the last access.
+ * @see `LinkedListGet()`.
  *
  * @param list `this`.
  * @param index Specified index.
  * @param value Value of element. It will be DEEP copied.
  */
-void LinkedListSet(LinkedList *const restrict list, const unsigned int index,
+void LinkedListSet(LinkedList *const restrict list, const size_t index,
                    const void *const restrict value);
 
 /**
@@ -197,7 +216,8 @@ void LinkedListPushBack(LinkedList *const restrict list,
                         const void *const restrict value);
 
 /**
- * @brief Remove the last element of `list`. O(n).
+ * @brief Remove the last element of `list`. O(n), or O(1) if the element
+ * before it was the last accessed by index.
  *
  * @param list `this`.
  */
@@ -221,12 +241,14 @@ void LinkedListPopFront(LinkedList *const restrict list);
 
 /**
  * @brief Add new element at the specified index of `list`. After element
- * added, `list[index]` will be the new element. O(n).
+ * added, `list[index]` will be the new element. O(n), or O(1) for the next
+ * index of the last access.
+ * @see `LinkedListGet()`.
  *
  * @param list `this`.
  * @param value Value of element. It will be DEEP copied.
  */
-void LinkedListInsert(LinkedList *const restrict list, const unsigned int index,
+void LinkedListInsert(LinkedList *const restrict list, const size_t index,
                       const void *const restrict value);
 
 /**
@@ -234,11 +256,11 @@ void LinkedListInsert(LinkedList *const restrict list, const unsigned int index,
  *
  * @param list `this`.
  * @param value Specified value.
- * @return int If found, the index of the element will be returned. If not
- * found, only `-1` will be returned.
+ * @return size_t If found, the index of the element will be returned. If not
+ * found, only `(size_t)-1` will be returned.
  */
-int LinkedListFind(LinkedList *const restrict list,
-                   const void *const restrict value);
+size_t LinkedListFind(LinkedList *const restrict list,
+                      const void *const restrict value);
 
 /**
  * @brief Slice `list`, and return new list which contains DEEP copied
@@ -250,8 +272,17 @@ int LinkedListFind(LinkedList *const restrict list,
  * @return LinkedList* New list with DEEP copied elements. This pointer will
  * NOT automatically be released.
  */
-LinkedList *LinkedListSlice(LinkedList *const restrict list,
-                            const unsigned int start, const unsigned int size);
+LinkedList *LinkedListSlice(LinkedList *const restrict list, const size_t start,
+                            const size_t size);
+
+/**
+ * @brief Use merge sort algorithm to sort `list`. Nodes are relinked instead
+ * of copying values, so no extra memory is needed and equal elements keep
+ * their order. O(nlog₂n).
+ *
+ * @param list `this`.
+ */
+void LinkedListMergeSort(LinkedList *const restrict list);
 
 /**
  * @brief Get iterator of `list`. O(1).
@@ -4,6 +4,8 @@
 #include <malloc.h>
 #include <memory.h>
 
+#include "batch-test.h"
+
 void LinkedQueueNodeConstruct(LinkedQueueNode *const restrict node,
                               const void *const restrict value,
                               const unsigned long elementSize) {
@@ -131,6 +133,45 @@ Bool LinkedQueueAll(LinkedQueue *const restrict queue,
     return TRUE;
 }
 
+/**
+ * @brief Copy values of `queue` into chunks of up to 64 values and pass every
+ * chunk into `test()`, until a chunk decides the result. O(n).
+ *
+ * @param queue Queue to be tested.
+ * @param test Batch test function.
+ * @param some If `TRUE`, a set bit decides. Otherwise, a clear bit decides.
+ * @return Bool Whether some chunk decided the result.
+ */
+static Bool __LinkedQueueBatch(LinkedQueue *const restrict queue,
+                               BatchTestFunction *const test,
+                               const Bool some) {
+    __BatchTestChunk chunk = {malloc(64 * queue->elementSize), 0,
+                              queue->elementSize, test, some};
+    assert(chunk.values != NULL);
+    Bool decided = FALSE;
+    for (LinkedQueueNode *node = queue->head; node != NULL && !decided;
+         node = node->next) {
+        decided = __BatchTestChunkPush(&chunk, node->value);
+    }
+    if (!decided) decided = __BatchTestChunkFlush(&chunk);
+    free(chunk.values);
+    return decided;
+}
+
+Bool LinkedQueueSomeBatch(LinkedQueue *const restrict queue,
+                          BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+    return __LinkedQueueBatch(queue, test, TRUE);
+}
+
+Bool LinkedQueueAllBatch(LinkedQueue *const restrict queue,
+                         BatchTestFunction *const test) {
+    assert(queue != NULL);
+    assert(test != NULL);
+    return !__LinkedQueueBatch(queue, test, FALSE);
+}
+
 LinkedQueueIterator LinkedQueueGetIterator(LinkedQueue *const restrict queue) {
     assert(queue != NULL);
     return queue->head;
@@ -63,7 +63,7 @@ typedef struct {
      * @attention Don't modify the value of this member directly. It is
      * maintained automatically.
      */
-    unsigned int Size;
+    size_t Size;
 } LinkedQueue;
 
 /**
@@ -186,6 +186,32 @@ Bool LinkedQueueSome(LinkedQueue *const restrict queue,
 Bool LinkedQueueAll(LinkedQueue *const restrict queue,
                     TestFunction *const test);
 
+/**
+ * @brief Values of elements in `queue` will be passed into `test()` in gathered
+ * chunks of up to 64 values. If any bit is returned set, `TRUE` will be
+ * returned immediately. Otherwise, `FALSE` will be returned. O(n).
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool LinkedQueueSomeBatch(LinkedQueue *const restrict queue,
+                          BatchTestFunction *const test);
+
+/**
+ * @brief Values of elements in `queue` will be passed into `test()` in gathered
+ * chunks of up to 64 values. If any bit is returned clear, `FALSE` will be
+ * returned immediately. Otherwise, `TRUE` will be returned. O(n).
+ *
+ * @param queue `this`.
+ * @param test Function used in checking which elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool LinkedQueueAllBatch(LinkedQueue *const restrict queue,
+                         BatchTestFunction *const test);
+
 /**
  * @brief Get iterator of `queue`. O(1).
  * @attention The returned value is shallow copied. Don't free it.
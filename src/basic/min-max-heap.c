@@ -0,0 +1,287 @@
+#include "min-max-heap.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+#include <stdint.h>
+
+/**
+ * @brief Get element at specified `index`. O(1).
+ *
+ * @param heap `this`.
+ * @param index Specified index.
+ * @return void* Element.
+ */
+static inline void *__at(const MinMaxHeap *const heap, const size_t index) {
+    return heap->array + index * heap->elementSize;
+}
+
+/**
+ * @brief Check if element at `index` is on a min level. O(1).
+ *
+ * @param index Specified index.
+ * @return Bool
+ */
+static inline Bool __isMinLevel(const size_t index) {
+    return (63 - __builtin_clzll(index + 1ull)) % 2 == 0;
+}
+
+/**
+ * @brief Check if `a` should be closer to the root than `b` on a min level
+ * (`min` is `TRUE`) or on a max level (`min` is `FALSE`). O(1).
+ *
+ * @param heap `this`.
+ * @param a One element.
+ * @param b The other element.
+ * @param min Kind of level.
+ * @return Bool
+ */
+static inline Bool __before(const MinMaxHeap *const heap,
+                            const void *const a, const void *const b,
+                            const Bool min) {
+    return min ? heap->compare(a, b) < 0 : heap->compare(a, b) > 0;
+}
+
+/**
+ * @brief Move `value` up from the empty slot `current` along its
+ * grandparents, which are all on min levels (`min` is `TRUE`) or all on max
+ * levels (`min` is `FALSE`). O(log₂n).
+ *
+ * @param heap `this`.
+ * @param current Index of the empty slot.
+ * @param value Value to be placed.
+ * @param min Kind of levels.
+ */
+static void __MinMaxHeapBubbleUp(MinMaxHeap *const restrict heap,
+                                 size_t current,
+                                 const void *const restrict value,
+                                 const Bool min) {
+    size_t grandparent = 0;
+    while (current > 2) {
+        grandparent = ((current - 1) / 2 - 1) / 2;
+        if (!__before(heap, value, __at(heap, grandparent), min)) break;
+        memcpy(__at(heap, current), __at(heap, grandparent),
+               heap->elementSize);
+        current = grandparent;
+    }
+    memcpy(__at(heap, current), value, heap->elementSize);
+}
+
+/**
+ * @brief Move `heap->cache` down from the empty slot `current`. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param current Index of the empty slot.
+ */
+static void __MinMaxHeapTrickleDown(MinMaxHeap *const restrict heap,
+                                    size_t current) {
+    const Bool min = __isMinLevel(current);
+    size_t child = 0, best = 0, end = 0, parent = 0;
+    while ((child = current * 2 + 1) < heap->Size) {
+        // find the best one among children and grandchildren
+        best = child;
+        if (child + 1 < heap->Size &&
+            __before(heap, __at(heap, child + 1), __at(heap, best), min))
+            best = child + 1;
+        end = child * 2 + 5 < heap->Size ? child * 2 + 5 : heap->Size;
+        for (size_t i = child * 2 + 1; i < end; i++) {
+            if (__before(heap, __at(heap, i), __at(heap, best), min)) best = i;
+        }
+        if (!__before(heap, __at(heap, best), heap->cache, min)) break;
+        memcpy(__at(heap, current), __at(heap, best), heap->elementSize);
+        current = best;
+        // a child is on the opposite level, so nothing is below it to fix
+        if (best <= child + 1) break;
+        parent = (best - 1) / 2;
+        if (__before(heap, heap->cache, __at(heap, parent), !min)) {
+            // swap cached value with the parent on the opposite level
+            memcpy(__at(heap, best), __at(heap, parent), heap->elementSize);
+            memcpy(__at(heap, parent), heap->cache, heap->elementSize);
+            memcpy(heap->cache, __at(heap, best), heap->elementSize);
+        }
+    }
+    memcpy(__at(heap, current), heap->cache, heap->elementSize);
+}
+
+/**
+ * @brief Make sure that `heap` can hold `size` elements. O(n).
+ *
+ * @param heap `this`.
+ * @param size Required capacity.
+ */
+static void __MinMaxHeapReserve(MinMaxHeap *const restrict heap,
+                                const size_t size) {
+    void *temp = NULL;
+    if (size <= heap->Capacity) return;
+
+    assert(size <= SIZE_MAX / heap->elementSize);
+    while (heap->Capacity < size) {
+        heap->Capacity = heap->Capacity <= SIZE_MAX / heap->elementSize / 2
+                             ? heap->Capacity * 2
+                             : SIZE_MAX / heap->elementSize;
+    }
+    temp = realloc(heap->array, heap->Capacity * heap->elementSize);
+    assert(temp != NULL);
+    heap->array = temp;
+}
+
+void MinMaxHeapConstruct(MinMaxHeap *const restrict heap,
+                         const size_t initialCapacity,
+                         const unsigned long elementSize,
+                         CompareFunction *const compare) {
+    assert(heap != NULL);
+    assert(initialCapacity > 0);
+    assert(elementSize > 0);
+    assert(compare != NULL);
+
+    heap->array = calloc(initialCapacity, elementSize);
+    assert(heap->array != NULL);
+    heap->cache = malloc(elementSize);
+    assert(heap->cache != NULL);
+    heap->elementSize = elementSize;
+    heap->Capacity = initialCapacity;
+    heap->compare = compare;
+    heap->Size = 0;
+}
+
+MinMaxHeap *MinMaxHeapNew(const size_t initialCapacity,
+                          const unsigned long elementSize,
+                          CompareFunction *const compare) {
+    MinMaxHeap *heap = (MinMaxHeap *)malloc(sizeof(MinMaxHeap));
+    MinMaxHeapConstruct(heap, initialCapacity, elementSize, compare);
+    return heap;
+}
+
+void MinMaxHeapDestruct(MinMaxHeap *const restrict heap) {
+    if (heap == NULL) return;
+    free(heap->array);
+    free(heap->cache);
+    heap->array = NULL;
+    heap->cache = NULL;
+    heap->Capacity = 0;
+    heap->Size = 0;
+    heap->elementSize = 0;
+    heap->compare = NULL;
+}
+
+void MinMaxHeapDelete(MinMaxHeap **const restrict heap) {
+    if (heap == NULL) return;
+    MinMaxHeapDestruct(*heap);
+    free(*heap);
+    *heap = NULL;
+}
+
+void *MinMaxHeapMin(const MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    return heap->array;
+}
+
+void *MinMaxHeapMax(const MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    if (heap->Size == 1) return heap->array;
+    if (heap->Size == 2 || heap->compare(__at(heap, 1), __at(heap, 2)) >= 0)
+        return __at(heap, 1);
+    return __at(heap, 2);
+}
+
+void MinMaxHeapPush(MinMaxHeap *const restrict heap,
+                    const void *const restrict value) {
+    assert(heap != NULL);
+    assert(value != NULL);
+    size_t current = heap->Size, parent = 0;
+    Bool min = __isMinLevel(current);
+
+    __MinMaxHeapReserve(heap, heap->Size + 1);
+    heap->Size++;
+    if (current != 0) {
+        parent = (current - 1) / 2;
+        if (__before(heap, value, __at(heap, parent), !min)) {
+            // belongs to the levels of its parent
+            memcpy(__at(heap, current), __at(heap, parent), heap->elementSize);
+            current = parent;
+            min = !min;
+        }
+    }
+    __MinMaxHeapBubbleUp(heap, current, value, min);
+}
+
+void MinMaxHeapBuild(MinMaxHeap *const restrict heap,
+                     const void *const restrict values, const size_t size) {
+    assert(heap != NULL);
+    assert(values != NULL);
+
+    __MinMaxHeapReserve(heap, heap->Size + size);
+    memcpy(__at(heap, heap->Size), values, size * heap->elementSize);
+    heap->Size += size;
+    for (size_t i = heap->Size / 2; i > 0; i--) {
+        memcpy(heap->cache, __at(heap, i - 1), heap->elementSize);
+        __MinMaxHeapTrickleDown(heap, i - 1);
+    }
+}
+
+void MinMaxHeapPopMin(MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+
+    heap->Size--;
+    if (heap->Size == 0) return;
+    memcpy(heap->cache, __at(heap, heap->Size), heap->elementSize);
+    __MinMaxHeapTrickleDown(heap, 0);
+}
+
+void MinMaxHeapPopMax(MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    size_t current = 0;
+
+    if (heap->Size <= 2) {
+        heap->Size--;
+        return;
+    }
+    current = heap->compare(__at(heap, 1), __at(heap, 2)) >= 0 ? 1 : 2;
+    heap->Size--;
+    if (current == heap->Size) return;
+    memcpy(heap->cache, __at(heap, heap->Size), heap->elementSize);
+    __MinMaxHeapTrickleDown(heap, current);
+}
+
+MinMaxHeapIterator MinMaxHeapGetIterator(MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    MinMaxHeapIterator iterator = {heap->array, heap->elementSize, 0,
+                                   heap->Size};
+    return iterator;
+}
+
+MinMaxHeapIterator MinMaxHeapGetReverseIterator(
+    MinMaxHeap *const restrict heap) {
+    assert(heap != NULL);
+    MinMaxHeapIterator iterator = {heap->array, heap->elementSize,
+                                   heap->Size - 1, heap->Size};
+    return iterator;
+}
+
+MinMaxHeapIterator MinMaxHeapIteratorNext(MinMaxHeapIterator const iterator) {
+    assert(iterator.current < iterator.size);
+    MinMaxHeapIterator i = {iterator.array, iterator.elementSize,
+                            iterator.current + 1, iterator.size};
+    return i;
+}
+
+MinMaxHeapIterator MinMaxHeapIteratorPrevious(
+    MinMaxHeapIterator const iterator) {
+    assert(iterator.current != -1);
+    MinMaxHeapIterator i = {iterator.array, iterator.elementSize,
+                            iterator.current - 1, iterator.size};
+    return i;
+}
+
+void *MinMaxHeapIteratorGetValue(MinMaxHeapIterator const iterator) {
+    assert(iterator.current < iterator.size && iterator.current != -1);
+    return iterator.array + iterator.current * iterator.elementSize;
+}
+
+Bool MinMaxHeapIteratorEnded(MinMaxHeapIterator const iterator) {
+    return iterator.current == iterator.size || iterator.current == -1;
+}
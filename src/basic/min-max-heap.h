@@ -0,0 +1,214 @@
+#ifndef __COLLECTIONS_MIN_MAX_HEAP__
+#define __COLLECTIONS_MIN_MAX_HEAP__
+
+#include "types.h"
+
+/**
+ * @brief Iterator of `MinMaxHeap`.
+ * @attention This iterator has no void head node. You can call
+ * `MinMaxHeapIteratorGetValue()` directly.
+ */
+typedef struct {
+    void *array;
+    unsigned long elementSize;
+    size_t current;
+    size_t size;
+} MinMaxHeapIterator;
+
+/**
+ * @brief Double-ended priority queue. Elements on even levels are not larger
+ * than their descendants, and elements on odd levels are not smaller than
+ * their descendants.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `MinMaxHeapConstruct()`, `MinMaxHeapNew()`, `MinMaxHeapDestruct()`,
+ * `MinMaxHeapDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief All elements will be stored in this member.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `MinMaxHeapMin()`, `MinMaxHeapMax()`, `MinMaxHeapPush()`,
+     * `MinMaxHeapPopMin()`, `MinMaxHeapPopMax()`.
+     */
+    void *array;
+    /**
+     * @private
+     * @brief Element size of this heap.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Function used in comparing two elements.
+     * @warning Don't modify this member directly.
+     */
+    CompareFunction *compare;
+    /**
+     * @private
+     * @brief Element used in moving values.
+     * @warning Don't modify this member directly.
+     */
+    void *cache;
+
+    /**
+     * @public
+     * @brief Current element quantity of this heap.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Size;
+    /**
+     * @public
+     * @brief Current element capacity of this heap. If `Size` is going to be
+     * larger than `Capacity`, this heap will automatically expand its
+     * capacity.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Capacity;
+} MinMaxHeap;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param heap Target to be constructed.
+ * @param initialCapacity Initial capacity of `heap`.
+ * @param elementSize Element size of `heap`.
+ * @param compare Function used in comparing two elements.
+ */
+void MinMaxHeapConstruct(MinMaxHeap *const restrict heap,
+                        const size_t initialCapacity,
+                        const unsigned long elementSize,
+                        CompareFunction *const compare);
+
+/**
+ * @brief Allocate a new heap in heap. O(1).
+ *
+ * @param initialCapacity Initial capacity of heap.
+ * @param elementSize Element size of heap.
+ * @param compare Function used in comparing two elements.
+ * @return MinMaxHeap* Pointer refering to a heap address.
+ */
+MinMaxHeap *MinMaxHeapNew(const size_t initialCapacity,
+                        const unsigned long elementSize,
+                        CompareFunction *const compare);
+
+/**
+ * @brief Destruct function. O(1).
+ *
+ * @param heap Target to be destructed. If `NULL`, nothing will happen.
+ */
+void MinMaxHeapDestruct(MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Release `heap` in heap. O(1).
+ *
+ * @param heap Pointer refers to the target which is to be deleted. The
+ * target will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void MinMaxHeapDelete(MinMaxHeap **const restrict heap);
+
+/**
+ * @brief Get value of the smallest element of `heap`. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param heap `this`.
+ * @return void* Value of the element.
+ */
+void *MinMaxHeapMin(const MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Get value of the largest element of `heap`. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param heap `this`.
+ * @return void* Value of the element.
+ */
+void *MinMaxHeapMax(const MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Add a new element into `heap`. O(log₂n).
+ *
+ * @param heap `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void MinMaxHeapPush(MinMaxHeap *const restrict heap,
+                    const void *const restrict value);
+
+/**
+ * @brief Add `size` elements into `heap` and rebuild it. O(n).
+ *
+ * @param heap `this`.
+ * @param values Array of elements. They will be DEEP copied.
+ * @param size Element quantity of `values`.
+ */
+void MinMaxHeapBuild(MinMaxHeap *const restrict heap,
+                     const void *const restrict values, const size_t size);
+
+/**
+ * @brief Remove the smallest element of `heap`. O(log₂n).
+ *
+ * @param heap `this`
+ */
+void MinMaxHeapPopMin(MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Remove the largest element of `heap`. O(log₂n).
+ *
+ * @param heap `this`
+ */
+void MinMaxHeapPopMax(MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Get iterator of `heap`. O(1).
+ *
+ * @param heap `this`.
+ * @return MinMaxHeapIterator Iterator.
+ */
+MinMaxHeapIterator MinMaxHeapGetIterator(MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Get reverse iterator of `heap`. O(1).
+ *
+ * @param heap `this`.
+ * @return MinMaxHeapIterator Iterator.
+ */
+MinMaxHeapIterator MinMaxHeapGetReverseIterator(
+    MinMaxHeap *const restrict heap);
+
+/**
+ * @brief Move to the next element. O(1).
+ *
+ * @param iterator `this`.
+ * @return MinMaxHeapIterator Renewed iterator.
+ */
+MinMaxHeapIterator MinMaxHeapIteratorNext(MinMaxHeapIterator const iterator);
+
+/**
+ * @brief Move to the previous element. O(1).
+ *
+ * @param iterator `this`.
+ * @return MinMaxHeapIterator Renewed iterator.
+ */
+MinMaxHeapIterator MinMaxHeapIteratorPrevious(
+    MinMaxHeapIterator const iterator);
+
+/**
+ * @brief Get value of current element. O(1).
+ *
+ * @param iterator `this`.
+ * @return void* Value of element.
+ */
+void *MinMaxHeapIteratorGetValue(MinMaxHeapIterator const iterator);
+
+/**
+ * @brief Check if iterator reaches end. O(1).
+ *
+ * @param iterator `this`.
+ * @return Bool.
+ */
+Bool MinMaxHeapIteratorEnded(MinMaxHeapIterator const iterator);
+
+#endif  // __COLLECTIONS_MIN_MAX_HEAP__
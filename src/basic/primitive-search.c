@@ -0,0 +1,478 @@
+#include "primitive-search.h"
+
+#include <assert.h>
+#include <math.h>
+#include <memory.h>
+
+/**
+ * @private
+ * @brief Storage for one value of any `PrimitiveType`.
+ */
+typedef union {
+    int Int32;
+    long long Int64;
+    float Float;
+    double Double;
+} __PrimitiveValue;
+
+/**
+ * @private
+ * @brief Kernels compiled for one instruction set.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Count elements equal to a value.
+     */
+    size_t (*countEqual)(const void *, size_t, PrimitiveType, const void *);
+    /**
+     * @private
+     * @brief Count elements within a closed range.
+     */
+    size_t (*countInRange)(const void *, size_t, PrimitiveType, const void *,
+                           const void *);
+    /**
+     * @private
+     * @brief Get the smallest or the largest value.
+     */
+    void (*extreme)(const void *, size_t, PrimitiveType, Bool, void *);
+} __PrimitiveKernels;
+
+/**
+ * @brief Element count handed to one kernel call while looking for the first
+ * match. Only a block with matches is scanned again element by element.
+ */
+static const size_t __BLOCK = 256;
+
+unsigned long PrimitiveSize(const PrimitiveType type) {
+    switch (type) {
+        case PRIMITIVE_INT32:
+            return sizeof(int);
+        case PRIMITIVE_INT64:
+            return sizeof(long long);
+        case PRIMITIVE_FLOAT:
+            return sizeof(float);
+        default:
+            return sizeof(double);
+    }
+}
+
+// 64-byte vectors. Inside each target wrapper below the compiler lowers them
+// to one AVX-512 register, two AVX2 registers or four SSE2 registers.
+typedef int __Int32x16 __attribute__((vector_size(64)));
+typedef long long __Int64x8 __attribute__((vector_size(64)));
+typedef float __Float32x16 __attribute__((vector_size(64)));
+typedef double __Float64x8 __attribute__((vector_size(64)));
+
+static inline __attribute__((always_inline)) size_t __CountEqual(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict value) {
+    size_t count = 0, i = 0;
+    switch (type) {
+        case PRIMITIVE_INT32: {
+            const int *elements = array, target = *(const int *)value;
+            const __Int32x16 targets = (__Int32x16){0} + target;
+            __Int32x16 counts = {0};
+            for (; i + 16 <= size; i += 16) {
+                __Int32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= chunk == targets;
+            }
+            for (size_t j = 0; j < 16; j++) count += counts[j];
+            for (; i < size; i++) count += elements[i] == target;
+            break;
+        }
+        case PRIMITIVE_INT64: {
+            const long long *elements = array,
+                            target = *(const long long *)value;
+            const __Int64x8 targets = (__Int64x8){0} + target;
+            __Int64x8 counts = {0};
+            for (; i + 8 <= size; i += 8) {
+                __Int64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= chunk == targets;
+            }
+            for (size_t j = 0; j < 8; j++) count += counts[j];
+            for (; i < size; i++) count += elements[i] == target;
+            break;
+        }
+        case PRIMITIVE_FLOAT: {
+            const float *elements = array, target = *(const float *)value;
+            const __Float32x16 targets = (__Float32x16){0} + target;
+            __Int32x16 counts = {0};
+            for (; i + 16 <= size; i += 16) {
+                __Float32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= chunk == targets;
+            }
+            for (size_t j = 0; j < 16; j++) count += counts[j];
+            for (; i < size; i++) count += elements[i] == target;
+            break;
+        }
+        case PRIMITIVE_DOUBLE: {
+            const double *elements = array, target = *(const double *)value;
+            const __Float64x8 targets = (__Float64x8){0} + target;
+            __Int64x8 counts = {0};
+            for (; i + 8 <= size; i += 8) {
+                __Float64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= chunk == targets;
+            }
+            for (size_t j = 0; j < 8; j++) count += counts[j];
+            for (; i < size; i++) count += elements[i] == target;
+            break;
+        }
+    }
+    return count;
+}
+
+static inline __attribute__((always_inline)) size_t __CountInRange(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict low,
+    const void *const restrict high) {
+    size_t count = 0, i = 0;
+    switch (type) {
+        case PRIMITIVE_INT32: {
+            const int *elements = array, min = *(const int *)low,
+                      max = *(const int *)high;
+            const __Int32x16 mins = (__Int32x16){0} + min,
+                             maxs = (__Int32x16){0} + max;
+            __Int32x16 counts = {0};
+            for (; i + 16 <= size; i += 16) {
+                __Int32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= (chunk >= mins) & (chunk <= maxs);
+            }
+            for (size_t j = 0; j < 16; j++) count += counts[j];
+            for (; i < size; i++) {
+                count += (elements[i] >= min) & (elements[i] <= max);
+            }
+            break;
+        }
+        case PRIMITIVE_INT64: {
+            const long long *elements = array, min = *(const long long *)low,
+                            max = *(const long long *)high;
+            const __Int64x8 mins = (__Int64x8){0} + min,
+                            maxs = (__Int64x8){0} + max;
+            __Int64x8 counts = {0};
+            for (; i + 8 <= size; i += 8) {
+                __Int64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= (chunk >= mins) & (chunk <= maxs);
+            }
+            for (size_t j = 0; j < 8; j++) count += counts[j];
+            for (; i < size; i++) {
+                count += (elements[i] >= min) & (elements[i] <= max);
+            }
+            break;
+        }
+        case PRIMITIVE_FLOAT: {
+            const float *elements = array, min = *(const float *)low,
+                        max = *(const float *)high;
+            const __Float32x16 mins = (__Float32x16){0} + min,
+                               maxs = (__Float32x16){0} + max;
+            __Int32x16 counts = {0};
+            for (; i + 16 <= size; i += 16) {
+                __Float32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= (chunk >= mins) & (chunk <= maxs);
+            }
+            for (size_t j = 0; j < 16; j++) count += counts[j];
+            for (; i < size; i++) {
+                count += (elements[i] >= min) & (elements[i] <= max);
+            }
+            break;
+        }
+        case PRIMITIVE_DOUBLE: {
+            const double *elements = array, min = *(const double *)low,
+                         max = *(const double *)high;
+            const __Float64x8 mins = (__Float64x8){0} + min,
+                              maxs = (__Float64x8){0} + max;
+            __Int64x8 counts = {0};
+            for (; i + 8 <= size; i += 8) {
+                __Float64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                counts -= (chunk >= mins) & (chunk <= maxs);
+            }
+            for (size_t j = 0; j < 8; j++) count += counts[j];
+            for (; i < size; i++) {
+                count += (elements[i] >= min) & (elements[i] <= max);
+            }
+            break;
+        }
+    }
+    return count;
+}
+
+static inline __attribute__((always_inline)) void __Extreme(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const Bool max, void *const restrict result) {
+    __PrimitiveValue *extreme = result;
+    size_t i = 0;
+    // Floating-point scans start from an infinity, so `NaN` never wins a
+    // comparison and is skipped.
+    switch (type) {
+        case PRIMITIVE_INT32: {
+            const int *elements = array;
+            int value = elements[0];
+            __Int32x16 values = (__Int32x16){0} + value;
+            for (; i + 16 <= size; i += 16) {
+                __Int32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                const __Int32x16 mask = max ? chunk > values : chunk < values;
+                values = (chunk & mask) | (values & ~mask);
+            }
+            for (size_t j = 0; j < 16; j++) {
+                if (max ? values[j] > value : values[j] < value) {
+                    value = values[j];
+                }
+            }
+            for (; i < size; i++) {
+                if (max ? elements[i] > value : elements[i] < value) {
+                    value = elements[i];
+                }
+            }
+            extreme->Int32 = value;
+            break;
+        }
+        case PRIMITIVE_INT64: {
+            const long long *elements = array;
+            long long value = elements[0];
+            __Int64x8 values = (__Int64x8){0} + value;
+            for (; i + 8 <= size; i += 8) {
+                __Int64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                const __Int64x8 mask = max ? chunk > values : chunk < values;
+                values = (chunk & mask) | (values & ~mask);
+            }
+            for (size_t j = 0; j < 8; j++) {
+                if (max ? values[j] > value : values[j] < value) {
+                    value = values[j];
+                }
+            }
+            for (; i < size; i++) {
+                if (max ? elements[i] > value : elements[i] < value) {
+                    value = elements[i];
+                }
+            }
+            extreme->Int64 = value;
+            break;
+        }
+        case PRIMITIVE_FLOAT: {
+            const float *elements = array;
+            float value = max ? -INFINITY : INFINITY;
+            __Float32x16 values = (__Float32x16){0} + value;
+            for (; i + 16 <= size; i += 16) {
+                __Float32x16 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                const __Int32x16 mask = max ? chunk > values : chunk < values;
+                values = (__Float32x16)(((__Int32x16)chunk & mask) |
+                                        ((__Int32x16)values & ~mask));
+            }
+            for (size_t j = 0; j < 16; j++) {
+                if (max ? values[j] > value : values[j] < value) {
+                    value = values[j];
+                }
+            }
+            for (; i < size; i++) {
+                if (max ? elements[i] > value : elements[i] < value) {
+                    value = elements[i];
+                }
+            }
+            extreme->Float = value;
+            break;
+        }
+        case PRIMITIVE_DOUBLE: {
+            const double *elements = array;
+            double value = max ? -INFINITY : INFINITY;
+            __Float64x8 values = (__Float64x8){0} + value;
+            for (; i + 8 <= size; i += 8) {
+                __Float64x8 chunk;
+                memcpy(&chunk, elements + i, sizeof(chunk));
+                const __Int64x8 mask = max ? chunk > values : chunk < values;
+                values = (__Float64x8)(((__Int64x8)chunk & mask) |
+                                       ((__Int64x8)values & ~mask));
+            }
+            for (size_t j = 0; j < 8; j++) {
+                if (max ? values[j] > value : values[j] < value) {
+                    value = values[j];
+                }
+            }
+            for (; i < size; i++) {
+                if (max ? elements[i] > value : elements[i] < value) {
+                    value = elements[i];
+                }
+            }
+            extreme->Double = value;
+            break;
+        }
+    }
+}
+
+// Baseline kernels. On x86-64 the baseline includes SSE2.
+
+static size_t __CountEqualDefault(const void *const restrict array,
+                                  const size_t size, const PrimitiveType type,
+                                  const void *const restrict value) {
+    return __CountEqual(array, size, type, value);
+}
+
+static size_t __CountInRangeDefault(const void *const restrict array,
+                                    const size_t size, const PrimitiveType type,
+                                    const void *const restrict low,
+                                    const void *const restrict high) {
+    return __CountInRange(array, size, type, low, high);
+}
+
+static void __ExtremeDefault(const void *const restrict array,
+                             const size_t size, const PrimitiveType type,
+                             const Bool max, void *const restrict result) {
+    __Extreme(array, size, type, max, result);
+}
+
+static const __PrimitiveKernels __DEFAULT = {
+    __CountEqualDefault, __CountInRangeDefault, __ExtremeDefault};
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx2"))) static size_t __CountEqualAvx2(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict value) {
+    return __CountEqual(array, size, type, value);
+}
+
+__attribute__((target("avx2"))) static size_t __CountInRangeAvx2(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict low,
+    const void *const restrict high) {
+    return __CountInRange(array, size, type, low, high);
+}
+
+__attribute__((target("avx2"))) static void __ExtremeAvx2(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const Bool max, void *const restrict result) {
+    __Extreme(array, size, type, max, result);
+}
+
+static const __PrimitiveKernels __AVX2 = {__CountEqualAvx2, __CountInRangeAvx2,
+                                          __ExtremeAvx2};
+
+__attribute__((target("avx512f"))) static size_t __CountEqualAvx512(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict value) {
+    return __CountEqual(array, size, type, value);
+}
+
+__attribute__((target("avx512f"))) static size_t __CountInRangeAvx512(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const void *const restrict low,
+    const void *const restrict high) {
+    return __CountInRange(array, size, type, low, high);
+}
+
+__attribute__((target("avx512f"))) static void __ExtremeAvx512(
+    const void *const restrict array, const size_t size,
+    const PrimitiveType type, const Bool max, void *const restrict result) {
+    __Extreme(array, size, type, max, result);
+}
+
+static const __PrimitiveKernels __AVX512 = {
+    __CountEqualAvx512, __CountInRangeAvx512, __ExtremeAvx512};
+
+#endif
+
+/**
+ * @brief Get kernels for the running CPU. Detection runs once. O(1).
+ *
+ * @return const __PrimitiveKernels* Kernels of the widest supported
+ * instruction set.
+ */
+static const __PrimitiveKernels *__kernels(void) {
+    static const __PrimitiveKernels *cache = NULL;
+    const __PrimitiveKernels *kernels =
+        __atomic_load_n(&cache, __ATOMIC_ACQUIRE);
+    if (kernels != NULL) return kernels;
+
+    kernels = &__DEFAULT;
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        kernels = &__AVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        kernels = &__AVX2;
+    }
+#endif
+    __atomic_store_n(&cache, kernels, __ATOMIC_RELEASE);
+    return kernels;
+}
+
+size_t PrimitiveFind(const void *const restrict array, const size_t size,
+                     const PrimitiveType type,
+                     const void *const restrict value) {
+    assert(array != NULL || size == 0);
+    assert(value != NULL);
+    const __PrimitiveKernels *kernels = __kernels();
+    const unsigned long elementSize = PrimitiveSize(type);
+    for (unsigned long start = 0; start < size; start += __BLOCK) {
+        const size_t count = size - start < __BLOCK ? size - start : __BLOCK;
+        const void *block = array + start * elementSize;
+        if (kernels->countEqual(block, count, type, value) == 0) continue;
+        for (size_t i = 0;; i++) {
+            if (__CountEqual(block + i * elementSize, 1, type, value) != 0) {
+                return start + i;
+            }
+        }
+    }
+    return -1;
+}
+
+size_t PrimitiveCount(const void *const restrict array, const size_t size,
+                      const PrimitiveType type,
+                      const void *const restrict value) {
+    assert(array != NULL || size == 0);
+    assert(value != NULL);
+    return __kernels()->countEqual(array, size, type, value);
+}
+
+size_t PrimitiveFindInRange(const void *const restrict array, const size_t size,
+                            const PrimitiveType type,
+                            const void *const restrict low,
+                            const void *const restrict high) {
+    assert(array != NULL || size == 0);
+    assert(low != NULL);
+    assert(high != NULL);
+    const __PrimitiveKernels *kernels = __kernels();
+    const unsigned long elementSize = PrimitiveSize(type);
+    for (unsigned long start = 0; start < size; start += __BLOCK) {
+        const size_t count = size - start < __BLOCK ? size - start : __BLOCK;
+        const void *block = array + start * elementSize;
+        if (kernels->countInRange(block, count, type, low, high) == 0) {
+            continue;
+        }
+        for (size_t i = 0;; i++) {
+            if (__CountInRange(block + i * elementSize, 1, type, low, high) !=
+                0) {
+                return start + i;
+            }
+        }
+    }
+    return -1;
+}
+
+size_t PrimitiveMin(const void *const restrict array, const size_t size,
+                    const PrimitiveType type) {
+    assert(array != NULL || size == 0);
+    if (size == 0) return -1;
+    __PrimitiveValue extreme;
+    __kernels()->extreme(array, size, type, FALSE, &extreme);
+    return PrimitiveFind(array, size, type, &extreme);
+}
+
+size_t PrimitiveMax(const void *const restrict array, const size_t size,
+                    const PrimitiveType type) {
+    assert(array != NULL || size == 0);
+    if (size == 0) return -1;
+    __PrimitiveValue extreme;
+    __kernels()->extreme(array, size, type, TRUE, &extreme);
+    return PrimitiveFind(array, size, type, &extreme);
+}
@@ -0,0 +1,110 @@
+#ifndef __COLLECTIONS_PRIMITIVE_SEARCH__
+#define __COLLECTIONS_PRIMITIVE_SEARCH__
+
+#include "types.h"
+
+/**
+ * @brief Type of elements scanned by primitive search functions.
+ */
+typedef enum {
+    /**
+     * @brief `int`, 4 bytes.
+     */
+    PRIMITIVE_INT32 = 0,
+    /**
+     * @brief `long long`, 8 bytes.
+     */
+    PRIMITIVE_INT64 = 1,
+    /**
+     * @brief `float`, 4 bytes.
+     */
+    PRIMITIVE_FLOAT = 2,
+    /**
+     * @brief `double`, 8 bytes.
+     */
+    PRIMITIVE_DOUBLE = 3
+} PrimitiveType;
+
+/**
+ * @brief Get size of one element of `type`. O(1).
+ *
+ * @param type Element type.
+ * @return unsigned long Element size in bytes.
+ */
+unsigned long PrimitiveSize(const PrimitiveType type);
+
+/**
+ * @brief Find the first element which is equal to `value`. Elements are
+ * compared directly instead of through a `CompareFunction`, using the widest
+ * vector instructions supported by the running CPU. Floating-point elements
+ * follow IEEE 754 equality: `NaN` equals nothing and `-0.0` equals `0.0`.
+ * O(n).
+ *
+ * @param array Pointer refers to the first element. It can be got from
+ * `ArrayListFront()` or `ArrayQueueFront()`.
+ * @param size Element count.
+ * @param type Element type.
+ * @param value Pointer refers to a value of `type`.
+ * @return size_t If found, the index of the element will be returned.
+ * Otherwise, `(size_t)-1` will be returned.
+ */
+size_t PrimitiveFind(const void *const restrict array, const size_t size,
+                     const PrimitiveType type,
+                     const void *const restrict value);
+
+/**
+ * @brief Count elements which are equal to `value`. O(n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param type Element type.
+ * @param value Pointer refers to a value of `type`.
+ * @return size_t Element count.
+ * @see `PrimitiveFind()`.
+ */
+size_t PrimitiveCount(const void *const restrict array, const size_t size,
+                      const PrimitiveType type,
+                      const void *const restrict value);
+
+/**
+ * @brief Find the first element which is not less than `low` and not greater
+ * than `high`. O(n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param type Element type.
+ * @param low Pointer refers to the lower bound(contained) of `type`.
+ * @param high Pointer refers to the upper bound(contained) of `type`.
+ * @return size_t If found, the index of the element will be returned.
+ * Otherwise, `(size_t)-1` will be returned.
+ */
+size_t PrimitiveFindInRange(const void *const restrict array, const size_t size,
+                            const PrimitiveType type,
+                            const void *const restrict low,
+                            const void *const restrict high);
+
+/**
+ * @brief Find the first smallest element. `NaN` elements are skipped. O(n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param type Element type.
+ * @return size_t Index of the element. If `size` is `0` or every element is
+ * `NaN`, `(size_t)-1` will be returned.
+ */
+size_t PrimitiveMin(const void *const restrict array, const size_t size,
+                    const PrimitiveType type);
+
+/**
+ * @brief Find the first largest element. `NaN` elements are skipped. O(n).
+ *
+ * @param array Pointer refers to the first element.
+ * @param size Element count.
+ * @param type Element type.
+ * @return size_t Index of the element. If `size` is `0` or every element is
+ * `NaN`, `(size_t)-1` will be returned.
+ */
+size_t PrimitiveMax(const void *const restrict array, const size_t size,
+                    const PrimitiveType type);
+
+#endif  // __COLLECTIONS_PRIMITIVE_SEARCH__
@@ -0,0 +1,264 @@
+#include "segmented-list.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+#include <stdint.h>
+
+/**
+ * @brief Count of bits in `size_t`, which is also the size of the directory.
+ */
+static const unsigned int __BITS = sizeof(size_t) * 8;
+
+/**
+ * @brief Get element at `index` from a directory of blocks. Adding the size
+ * of the first block to `index` makes the position of its highest set bit
+ * select the block, and the remaining bits the offset inside it. O(1).
+ *
+ * @param blocks Directory of blocks.
+ * @param shift Binary logarithm of the element count of the first block.
+ * @param elementSize Element size.
+ * @param index Specified index.
+ * @return void* The element.
+ */
+static inline void *__at(void *const *const blocks, const unsigned int shift,
+                         const unsigned long elementSize, const size_t index) {
+    const size_t position = index + ((size_t)1 << shift);
+    const unsigned int bit = __BITS - 1 - __builtin_clzl(position);
+    return blocks[bit - shift] +
+           (position - ((size_t)1 << bit)) * elementSize;
+}
+
+/**
+ * @brief Allocate the next block of `list`. O(1).
+ *
+ * @param list `this`.
+ */
+static void __SegmentedListGrow(SegmentedList *const restrict list) {
+    const unsigned int bit = list->shift + list->blockCount;
+    assert(bit < __BITS);
+    const size_t size = (size_t)1 << bit;
+    // Both the byte size of the block and the new capacity must fit.
+    assert(size <= SIZE_MAX / list->elementSize);
+    assert(list->Capacity <= SIZE_MAX - size);
+    void *block = malloc(size * list->elementSize);
+    assert(block != NULL);
+    list->blocks[list->blockCount] = block;
+    list->blockCount++;
+    list->Capacity += size;
+}
+
+void SegmentedListConstruct(SegmentedList *const restrict list,
+                            const size_t initialCapacity,
+                            const unsigned long elementSize,
+                            CompareFunction *const compare) {
+    assert(list != NULL);
+    assert(initialCapacity > 0);
+    assert(elementSize > 0);
+    assert(compare != NULL);
+
+    unsigned int shift = 0;
+    while (shift + 1 < __BITS && ((size_t)1 << shift) < initialCapacity) {
+        shift++;
+    }
+    list->blockCount = 0;
+    list->shift = shift;
+    list->elementSize = elementSize;
+    list->compare = compare;
+    list->Size = 0;
+    list->Capacity = 0;
+    __SegmentedListGrow(list);
+}
+
+SegmentedList *SegmentedListNew(const size_t initialCapacity,
+                                const unsigned long elementSize,
+                                CompareFunction *const compare) {
+    SegmentedList *list = (SegmentedList *)malloc(sizeof(SegmentedList));
+    SegmentedListConstruct(list, initialCapacity, elementSize, compare);
+    return list;
+}
+
+void SegmentedListDestruct(SegmentedList *const restrict list) {
+    if (list == NULL) return;
+    for (unsigned int i = 0; i < list->blockCount; i++) {
+        free(list->blocks[i]);
+        list->blocks[i] = NULL;
+    }
+    list->blockCount = 0;
+    list->shift = 0;
+    list->elementSize = 0;
+    list->compare = NULL;
+    list->Size = 0;
+    list->Capacity = 0;
+}
+
+void SegmentedListDelete(SegmentedList **const restrict list) {
+    if (list == NULL) return;
+    SegmentedListDestruct(*list);
+    free(*list);
+    *list = NULL;
+}
+
+void SegmentedListReserve(SegmentedList *const restrict list,
+                          const size_t capacity) {
+    assert(list != NULL);
+    while (list->Capacity < capacity) __SegmentedListGrow(list);
+}
+
+void SegmentedListShrinkToFit(SegmentedList *const restrict list) {
+    assert(list != NULL);
+    while (list->blockCount > 1) {
+        const size_t size = (size_t)1
+                            << (list->shift + list->blockCount - 1);
+        if (list->Capacity - size < list->Size) break;
+        list->blockCount--;
+        free(list->blocks[list->blockCount]);
+        list->blocks[list->blockCount] = NULL;
+        list->Capacity -= size;
+    }
+}
+
+void *SegmentedListGet(const SegmentedList *const restrict list,
+                       const size_t index) {
+    assert(list != NULL);
+    assert(index < list->Size);
+    return __at(list->blocks, list->shift, list->elementSize, index);
+}
+
+void SegmentedListSet(SegmentedList *const restrict list, const size_t index,
+                      const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    assert(index < list->Size);
+    memcpy(__at(list->blocks, list->shift, list->elementSize, index), value,
+           list->elementSize);
+}
+
+void *SegmentedListBack(const SegmentedList *const restrict list) {
+    assert(list != NULL);
+    if (list->Size == 0) return NULL;
+    return __at(list->blocks, list->shift, list->elementSize, list->Size - 1);
+}
+
+void *SegmentedListFront(const SegmentedList *const restrict list) {
+    assert(list != NULL);
+    if (list->Size == 0) return NULL;
+    return list->blocks[0];
+}
+
+void SegmentedListPushBack(SegmentedList *const restrict list,
+                           const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    if (list->Size == list->Capacity) __SegmentedListGrow(list);
+    memcpy(__at(list->blocks, list->shift, list->elementSize, list->Size),
+           value, list->elementSize);
+    list->Size++;
+}
+
+void SegmentedListPopBack(SegmentedList *const restrict list) {
+    assert(list != NULL);
+    assert(list->Size > 0);
+    list->Size--;
+}
+
+size_t SegmentedListFind(const SegmentedList *const restrict list,
+                         const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    size_t index = 0;
+    for (unsigned int i = 0; index < list->Size; i++) {
+        const size_t size = (size_t)1 << (list->shift + i);
+        const size_t count =
+            list->Size - index < size ? list->Size - index : size;
+        for (size_t j = 0; j < count; j++) {
+            if (list->compare(list->blocks[i] + j * list->elementSize,
+                              value) == 0) {
+                return index + j;
+            }
+        }
+        index += count;
+    }
+    return -1;
+}
+
+Bool SegmentedListSome(const SegmentedList *const restrict list,
+                       TestFunction *const test) {
+    assert(list != NULL);
+    assert(test != NULL);
+    size_t index = 0;
+    for (unsigned int i = 0; index < list->Size; i++) {
+        const size_t size = (size_t)1 << (list->shift + i);
+        const size_t count =
+            list->Size - index < size ? list->Size - index : size;
+        for (size_t j = 0; j < count; j++) {
+            if (test(list->blocks[i] + j * list->elementSize) == TRUE)
+                return TRUE;
+        }
+        index += count;
+    }
+    return FALSE;
+}
+
+Bool SegmentedListAll(const SegmentedList *const restrict list,
+                      TestFunction *const test) {
+    assert(list != NULL);
+    assert(test != NULL);
+    size_t index = 0;
+    for (unsigned int i = 0; index < list->Size; i++) {
+        const size_t size = (size_t)1 << (list->shift + i);
+        const size_t count =
+            list->Size - index < size ? list->Size - index : size;
+        for (size_t j = 0; j < count; j++) {
+            if (test(list->blocks[i] + j * list->elementSize) == FALSE)
+                return FALSE;
+        }
+        index += count;
+    }
+    return TRUE;
+}
+
+SegmentedListIterator SegmentedListGetIterator(
+    SegmentedList *const restrict list) {
+    assert(list != NULL);
+    SegmentedListIterator iterator = {list->blocks, list->elementSize,
+                                      list->shift, 0, list->Size};
+    return iterator;
+}
+
+SegmentedListIterator SegmentedListGetReverseIterator(
+    SegmentedList *const restrict list) {
+    assert(list != NULL);
+    SegmentedListIterator iterator = {list->blocks, list->elementSize,
+                                      list->shift, list->Size - 1,
+                                      list->Size};
+    return iterator;
+}
+
+SegmentedListIterator SegmentedListIteratorNext(
+    SegmentedListIterator const iterator) {
+    assert(iterator.current < iterator.size);
+    SegmentedListIterator i = {iterator.blocks, iterator.elementSize,
+                               iterator.shift, iterator.current + 1,
+                               iterator.size};
+    return i;
+}
+
+SegmentedListIterator SegmentedListIteratorPrevious(
+    SegmentedListIterator const iterator) {
+    assert(iterator.current != -1);
+    SegmentedListIterator i = {iterator.blocks, iterator.elementSize,
+                               iterator.shift, iterator.current - 1,
+                               iterator.size};
+    return i;
+}
+
+void *SegmentedListIteratorGetValue(SegmentedListIterator const iterator) {
+    assert(iterator.current < iterator.size && iterator.current != -1);
+    return __at(iterator.blocks, iterator.shift, iterator.elementSize,
+                iterator.current);
+}
+
+Bool SegmentedListIteratorEnded(SegmentedListIterator const iterator) {
+    return iterator.current == iterator.size || iterator.current == -1;
+}
@@ -0,0 +1,289 @@
+#ifndef __COLLECTIONS_SEGMENTED_LIST__
+#define __COLLECTIONS_SEGMENTED_LIST__
+
+#include "types.h"
+
+/**
+ * @brief Iterator of `SegmentedList`.
+ * @attention This iterator has no void head node. You can call
+ * `SegmentedListIteratorGetValue()` directly.
+ */
+typedef struct {
+    void *const *blocks;
+    unsigned long elementSize;
+    unsigned int shift;
+    size_t current;
+    size_t size;
+} SegmentedListIterator;
+
+/**
+ * @brief A list whose elements are stored in blocks of geometrically growing
+ * sizes. Block `k` holds `2^(shift + k)` elements, so the block and offset of
+ * an index are found with one bit scan. Growth only allocates a new block and
+ * never moves existing elements, so pointers to elements stay valid until
+ * they are popped.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `SegmentedListConstruct()`, `SegmentedListNew()`,
+ * `SegmentedListDestruct()`, `SegmentedListDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Directory of blocks. Only the first `blockCount` entries are
+     * allocated.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `SegmentedListGet()`, `SegmentedListPushBack()`,
+     * `SegmentedListPopBack()`.
+     */
+    void *blocks[sizeof(size_t) * 8];
+    /**
+     * @private
+     * @brief Count of allocated blocks.
+     * @warning Don't modify this member directly.
+     */
+    unsigned int blockCount;
+    /**
+     * @private
+     * @brief Binary logarithm of the element count of the first block.
+     * @warning Don't modify this member directly.
+     */
+    unsigned int shift;
+    /**
+     * @private
+     * @brief Element size of this list.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Function used in comparing two elements.
+     * @warning Don't modify this member directly.
+     */
+    CompareFunction *compare;
+
+    /**
+     * @public
+     * @brief Current element quantity of this list.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Size;
+    /**
+     * @public
+     * @brief Element capacity of allocated blocks. If `Size` is going to be
+     * larger than `Capacity`, a new block will be allocated.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Capacity;
+} SegmentedList;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param list Target to be constructed.
+ * @param initialCapacity Initial capacity of `list`. It is rounded up to a
+ * power of two, which becomes the size of the first block.
+ * @param elementSize Element size of `list`.
+ * @param compare Function used in comparing two elements.
+ */
+void SegmentedListConstruct(SegmentedList *const restrict list,
+                            const size_t initialCapacity,
+                            const unsigned long elementSize,
+                            CompareFunction *const compare);
+
+/**
+ * @brief Allocate a new list in heap. O(1).
+ *
+ * @param initialCapacity Initial capacity of list.
+ * @param elementSize Element size of list.
+ * @param compare Function used in comparing two elements.
+ * @return SegmentedList* Pointer refering to a heap address.
+ */
+SegmentedList *SegmentedListNew(const size_t initialCapacity,
+                                const unsigned long elementSize,
+                                CompareFunction *const compare);
+
+/**
+ * @brief Destruct function. O(log₂n).
+ *
+ * @param list Target to be destructed. If `NULL`, nothing will happen.
+ */
+void SegmentedListDestruct(SegmentedList *const restrict list);
+
+/**
+ * @brief Release `list` in heap. O(log₂n).
+ *
+ * @param list Pointer refers to the target which is to be deleted. The target
+ * will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void SegmentedListDelete(SegmentedList **const restrict list);
+
+/**
+ * @brief Make sure that `list` can hold `capacity` elements by allocating
+ * blocks. Existing elements are not moved. O(log₂n).
+ *
+ * @param list `this`.
+ * @param capacity Required capacity.
+ */
+void SegmentedListReserve(SegmentedList *const restrict list,
+                          const size_t capacity);
+
+/**
+ * @brief Release blocks which hold no element, but keep the first one.
+ * O(log₂n).
+ *
+ * @param list `this`.
+ */
+void SegmentedListShrinkToFit(SegmentedList *const restrict list);
+
+/**
+ * @brief Get element at `index`. O(1).
+ * @attention The returned value is shallow copied. Don't free it. It stays
+ * valid until the element is popped, even if `list` grows.
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return void* Value of element.
+ */
+void *SegmentedListGet(const SegmentedList *const restrict list,
+                       const size_t index);
+
+/**
+ * @brief Set element at `index`. O(1).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void SegmentedListSet(SegmentedList *const restrict list, const size_t index,
+                      const void *const restrict value);
+
+/**
+ * @brief Get the last element of `list`. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param list `this`.
+ * @return void* If `list` is not empty, the element will be returned.
+ * Otherwise, `NULL` will be returned.
+ */
+void *SegmentedListBack(const SegmentedList *const restrict list);
+
+/**
+ * @brief Get the first element of `list`. O(1).
+ * @attention The returned value is shallow copied. Don't free it. Unlike
+ * `ArrayListFront()`, following elements are not contiguous with it.
+ *
+ * @param list `this`.
+ * @return void* If `list` is not empty, the element will be returned.
+ * Otherwise, `NULL` will be returned.
+ */
+void *SegmentedListFront(const SegmentedList *const restrict list);
+
+/**
+ * @brief Add new element at the end of `list`. O(1).
+ *
+ * @param list `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void SegmentedListPushBack(SegmentedList *const restrict list,
+                           const void *const restrict value);
+
+/**
+ * @brief Remove the last element of `list`. Blocks are kept for reuse. O(1).
+ *
+ * @param list `this`.
+ */
+void SegmentedListPopBack(SegmentedList *const restrict list);
+
+/**
+ * @brief Find the first element which is equal to `value`. O(n).
+ *
+ * @param list `this`.
+ * @param value Specified value.
+ * @return size_t If found, the index of the element will be returned.
+ * Otherwise, `(size_t)-1` will be returned.
+ */
+size_t SegmentedListFind(const SegmentedList *const restrict list,
+                         const void *const restrict value);
+
+/**
+ * @brief Every element in `list` will be passed into `test()`, block by block.
+ * If `test()` returns `TRUE`, `TRUE` will be returned immediately. If `FALSE`
+ * is always returned by `test()`, `FALSE` will be returned. O(n).
+ *
+ * @param list `this`.
+ * @param test Function used in checking if some elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool SegmentedListSome(const SegmentedList *const restrict list,
+                       TestFunction *const test);
+
+/**
+ * @brief Every element in `list` will be passed into `test()`, block by block.
+ * If `test()` returns `FALSE`, `FALSE` will be returned immediately. If `TRUE`
+ * is always returned by `test()`, `TRUE` will be returned. O(n).
+ *
+ * @param list `this`.
+ * @param test Function used in checking if all elements satisfy certain
+ * conditions.
+ * @return Bool
+ */
+Bool SegmentedListAll(const SegmentedList *const restrict list,
+                      TestFunction *const test);
+
+/**
+ * @brief Get iterator of `list`. O(1).
+ *
+ * @param list `this`.
+ * @return SegmentedListIterator Iterator.
+ */
+SegmentedListIterator SegmentedListGetIterator(
+    SegmentedList *const restrict list);
+
+/**
+ * @brief Get reverse iterator of `list`. O(1).
+ *
+ * @param list `this`.
+ * @return SegmentedListIterator Iterator.
+ */
+SegmentedListIterator SegmentedListGetReverseIterator(
+    SegmentedList *const restrict list);
+
+/**
+ * @brief Move to the next element. O(1).
+ *
+ * @param iterator `this`.
+ * @return SegmentedListIterator Renewed iterator.
+ */
+SegmentedListIterator SegmentedListIteratorNext(
+    SegmentedListIterator const iterator);
+
+/**
+ * @brief Move to the previous element. O(1).
+ *
+ * @param iterator `this`.
+ * @return SegmentedListIterator Renewed iterator.
+ */
+SegmentedListIterator SegmentedListIteratorPrevious(
+    SegmentedListIterator const iterator);
+
+/**
+ * @brief Get value of current element. O(1).
+ *
+ * @param iterator `this`.
+ * @return void* Value of element.
+ */
+void *SegmentedListIteratorGetValue(SegmentedListIterator const iterator);
+
+/**
+ * @brief Check if iterator reaches end. O(1).
+ *
+ * @param iterator `this`.
+ * @return Bool.
+ */
+Bool SegmentedListIteratorEnded(SegmentedListIterator const iterator);
+
+#endif  // __COLLECTIONS_SEGMENTED_LIST__
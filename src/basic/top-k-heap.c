@@ -0,0 +1,137 @@
+#include "top-k-heap.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+
+/**
+ * @brief Get element at specified `index`. O(1).
+ *
+ * @param heap `this`.
+ * @param index Specified index.
+ * @return void* Element.
+ */
+static inline void *__at(const TopKHeap *const heap, const size_t index) {
+    return heap->array + index * heap->elementSize;
+}
+
+/**
+ * @brief Move `value` down from the empty top, considering only the first
+ * `size` elements. O(log₂k).
+ *
+ * @param heap `this`.
+ * @param value Value to be placed. It must not be inside the first `size`
+ * elements.
+ * @param size Element quantity of the heap part.
+ */
+static void __TopKHeapSiftDown(TopKHeap *const restrict heap,
+                               const void *const restrict value,
+                               const size_t size) {
+    size_t current = 0, child = 0;
+    while ((child = current * 2 + 1) < size) {
+        if (child + 1 < size &&
+            heap->compare(__at(heap, child + 1), __at(heap, child)) < 0)
+            child++;
+        if (heap->compare(__at(heap, child), value) >= 0) break;
+        memcpy(__at(heap, current), __at(heap, child), heap->elementSize);
+        current = child;
+    }
+    memcpy(__at(heap, current), value, heap->elementSize);
+}
+
+void TopKHeapConstruct(TopKHeap *const restrict heap, const size_t k,
+                       const unsigned long elementSize,
+                       CompareFunction *const compare) {
+    assert(heap != NULL);
+    assert(k > 0);
+    assert(elementSize > 0);
+    assert(compare != NULL);
+
+    heap->array = malloc(k * elementSize);
+    assert(heap->array != NULL);
+    heap->cache = malloc(elementSize);
+    assert(heap->cache != NULL);
+    heap->elementSize = elementSize;
+    heap->compare = compare;
+    heap->Capacity = k;
+    heap->Size = 0;
+}
+
+TopKHeap *TopKHeapNew(const size_t k, const unsigned long elementSize,
+                      CompareFunction *const compare) {
+    TopKHeap *heap = (TopKHeap *)malloc(sizeof(TopKHeap));
+    TopKHeapConstruct(heap, k, elementSize, compare);
+    return heap;
+}
+
+void TopKHeapDestruct(TopKHeap *const restrict heap) {
+    if (heap == NULL) return;
+    free(heap->array);
+    free(heap->cache);
+    heap->array = NULL;
+    heap->cache = NULL;
+    heap->elementSize = 0;
+    heap->compare = NULL;
+    heap->Capacity = 0;
+    heap->Size = 0;
+}
+
+void TopKHeapDelete(TopKHeap **const restrict heap) {
+    if (heap == NULL) return;
+    TopKHeapDestruct(*heap);
+    free(*heap);
+    *heap = NULL;
+}
+
+void *TopKHeapThreshold(const TopKHeap *const restrict heap) {
+    assert(heap != NULL);
+    assert(heap->Size > 0);
+    return heap->array;
+}
+
+Bool TopKHeapPush(TopKHeap *const restrict heap,
+                  const void *const restrict value) {
+    assert(heap != NULL);
+    assert(value != NULL);
+    size_t current = heap->Size, parent = 0;
+
+    if (heap->Size == heap->Capacity) {
+        if (heap->compare(value, heap->array) <= 0) return FALSE;
+        __TopKHeapSiftDown(heap, value, heap->Size);
+        return TRUE;
+    }
+    while (current != 0) {
+        parent = (current - 1) / 2;
+        if (heap->compare(value, __at(heap, parent)) >= 0) break;
+        memcpy(__at(heap, current), __at(heap, parent), heap->elementSize);
+        current = parent;
+    }
+    memcpy(__at(heap, current), value, heap->elementSize);
+    heap->Size++;
+    return TRUE;
+}
+
+void TopKHeapMerge(TopKHeap *const restrict heap,
+                   const TopKHeap *const restrict other) {
+    assert(heap != NULL);
+    assert(other != NULL);
+    assert(heap->elementSize == other->elementSize);
+
+    for (size_t i = 0; i < other->Size; i++) {
+        TopKHeapPush(heap, other->array + i * other->elementSize);
+    }
+}
+
+void TopKHeapDrain(TopKHeap *const restrict heap, void *const restrict output) {
+    assert(heap != NULL);
+    assert(output != NULL);
+
+    // heap sort: the smallest remaining element is moved to the end
+    for (size_t size = heap->Size; size > 1; size--) {
+        memcpy(heap->cache, __at(heap, size - 1), heap->elementSize);
+        memcpy(__at(heap, size - 1), heap->array, heap->elementSize);
+        __TopKHeapSiftDown(heap, heap->cache, size - 1);
+    }
+    memcpy(output, heap->array, heap->Size * heap->elementSize);
+    heap->Size = 0;
+}
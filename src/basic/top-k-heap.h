@@ -0,0 +1,137 @@
+#ifndef __COLLECTIONS_TOP_K_HEAP__
+#define __COLLECTIONS_TOP_K_HEAP__
+
+#include "types.h"
+
+/**
+ * @brief Fixed-capacity accumulator of the largest elements of a stream. It is
+ * laid out like `ArrayHeap`, but with the inverted order: the smallest kept
+ * element is on the top, so every new element is compared with it once and
+ * rejected early if it is not larger.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `TopKHeapConstruct()`, `TopKHeapNew()`, `TopKHeapDestruct()`,
+ * `TopKHeapDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief All elements will be stored in this member.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `TopKHeapThreshold()`, `TopKHeapPush()`, `TopKHeapDrain()`.
+     */
+    void *array;
+    /**
+     * @private
+     * @brief Element size of this heap.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Function used in comparing two elements.
+     * @warning Don't modify this member directly.
+     */
+    CompareFunction *compare;
+    /**
+     * @private
+     * @brief Element used in moving values.
+     * @warning Don't modify this member directly.
+     */
+    void *cache;
+
+    /**
+     * @public
+     * @brief Current element quantity of this heap.
+     * @attention Don't change value of this member directly. It is maintained
+     * automatically.
+     */
+    size_t Size;
+    /**
+     * @public
+     * @brief Maximum element quantity of this heap, which is K.
+     * @attention Don't change value of this member directly.
+     */
+    size_t Capacity;
+} TopKHeap;
+
+/**
+ * @brief Constructor function. O(1).
+ *
+ * @param heap Target to be constructed.
+ * @param k Quantity of the largest elements to be kept.
+ * @param elementSize Element size of `heap`.
+ * @param compare Function used in comparing two elements.
+ */
+void TopKHeapConstruct(TopKHeap *const restrict heap, const size_t k,
+                       const unsigned long elementSize,
+                       CompareFunction *const compare);
+
+/**
+ * @brief Allocate a new heap in heap. O(1).
+ *
+ * @param k Quantity of the largest elements to be kept.
+ * @param elementSize Element size of heap.
+ * @param compare Function used in comparing two elements.
+ * @return TopKHeap* Pointer refering to a heap address.
+ */
+TopKHeap *TopKHeapNew(const size_t k, const unsigned long elementSize,
+                      CompareFunction *const compare);
+
+/**
+ * @brief Destruct function. O(1).
+ *
+ * @param heap Target to be destructed. If `NULL`, nothing will happen.
+ */
+void TopKHeapDestruct(TopKHeap *const restrict heap);
+
+/**
+ * @brief Release `heap` in heap. O(1).
+ *
+ * @param heap Pointer refers to the target which is to be deleted. The
+ * target will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void TopKHeapDelete(TopKHeap **const restrict heap);
+
+/**
+ * @brief Get value of the smallest kept element. Once `heap` is full, only
+ * elements larger than it will be kept. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param heap `this`.
+ * @return void* Value of the element.
+ */
+void *TopKHeapThreshold(const TopKHeap *const restrict heap);
+
+/**
+ * @brief Offer a new element to `heap`. If `heap` is full, the element is
+ * compared with the smallest kept element once, and replaces it with a single
+ * sift-down if it is larger. O(1) if rejected, O(log₂k) otherwise.
+ *
+ * @param heap `this`.
+ * @param value Value of element. It will be DEEP copied if kept.
+ * @return Bool If the element is kept, `TRUE` will be returned.
+ */
+Bool TopKHeapPush(TopKHeap *const restrict heap,
+                  const void *const restrict value);
+
+/**
+ * @brief Offer every element of `other` to `heap`. It is used in combining
+ * partial results, e.g. from worker threads. O(k log₂k).
+ *
+ * @param heap `this`.
+ * @param other Heap to be merged. It will NOT be modified.
+ */
+void TopKHeapMerge(TopKHeap *const restrict heap,
+                   const TopKHeap *const restrict other);
+
+/**
+ * @brief Move all elements into `output` from the largest to the smallest,
+ * and empty `heap`. The elements are sorted in place. O(k log₂k).
+ *
+ * @param heap `this`.
+ * @param output Array which can hold `heap->Size` elements.
+ */
+void TopKHeapDrain(TopKHeap *const restrict heap, void *const restrict output);
+
+#endif  // __COLLECTIONS_TOP_K_HEAP__
@@ -0,0 +1,364 @@
+#include "unrolled-list.h"
+
+#include <assert.h>
+#include <malloc.h>
+#include <memory.h>
+
+/**
+ * @brief Preferred byte size of the values of one node, which is four cache
+ * lines on most CPUs.
+ */
+static const unsigned long __NODE_BYTES = 256;
+
+void UnrolledListConstruct(UnrolledList *const restrict list,
+                           const unsigned long elementSize,
+                           CompareFunction *const compare) {
+    assert(list != NULL);
+    assert(compare != NULL);
+    assert(elementSize > 0);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->elementSize = elementSize;
+    list->nodeCapacity =
+        __NODE_BYTES / elementSize >= 4 ? __NODE_BYTES / elementSize : 4;
+    list->compare = compare;
+    list->Size = 0;
+}
+
+UnrolledList *UnrolledListNew(const unsigned long elementSize,
+                              CompareFunction *const compare) {
+    UnrolledList *list = (UnrolledList *)malloc(sizeof(UnrolledList));
+    UnrolledListConstruct(list, elementSize, compare);
+    return list;
+}
+
+void UnrolledListDestruct(UnrolledList *const restrict list) {
+    if (list == NULL) return;
+
+    UnrolledListNode *node = list->head;
+    while (node != NULL) {
+        UnrolledListNode *temp = node->next;
+        free(node);
+        node = temp;
+    }
+    list->compare = NULL;
+    list->elementSize = 0;
+    list->nodeCapacity = 0;
+    list->Size = 0;
+    list->head = NULL;
+    list->tail = NULL;
+}
+
+void UnrolledListDelete(UnrolledList **const restrict list) {
+    if (list == NULL) return;
+
+    UnrolledListDestruct(*list);
+    free(*list);
+    *list = NULL;
+}
+
+/**
+ * @brief Allocate an empty node and link it after `previous`. O(1).
+ *
+ * @param list `this`.
+ * @param previous Pointer refers to the node before the new one. If `NULL`,
+ * the new node becomes the head.
+ * @return UnrolledListNode* The new node.
+ */
+static UnrolledListNode *__UnrolledListLink(
+    UnrolledList *const restrict list, UnrolledListNode *const previous) {
+    UnrolledListNode *node = (UnrolledListNode *)malloc(
+        sizeof(UnrolledListNode) + list->nodeCapacity * list->elementSize);
+    assert(node != NULL);
+    node->count = 0;
+    node->previous = previous;
+    node->next = previous != NULL ? previous->next : list->head;
+    if (node->next != NULL) {
+        node->next->previous = node;
+    } else {
+        list->tail = node;
+    }
+    if (previous != NULL) {
+        previous->next = node;
+    } else {
+        list->head = node;
+    }
+    return node;
+}
+
+/**
+ * @brief Unlink `node` from `list` and release it. O(1).
+ *
+ * @param list `this`.
+ * @param node Node to be released.
+ */
+static void __UnrolledListUnlink(UnrolledList *const restrict list,
+                                 UnrolledListNode *const node) {
+    if (node->previous != NULL) {
+        node->previous->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->previous = node->previous;
+    } else {
+        list->tail = node->previous;
+    }
+    free(node);
+}
+
+/**
+ * @brief Find the node which holds the element at `*index`, walking from the
+ * nearer end. O(n / nodeCapacity).
+ *
+ * @param list `this`.
+ * @param index Pointer refers to the index. It is replaced by the offset of
+ * the element in the returned node.
+ * @return UnrolledListNode* The node.
+ */
+static UnrolledListNode *__UnrolledListLocate(
+    const UnrolledList *const restrict list, size_t *const restrict index) {
+    UnrolledListNode *node = NULL;
+    if (*index < list->Size / 2) {
+        node = list->head;
+        while (*index >= node->count) {
+            *index -= node->count;
+            node = node->next;
+        }
+        return node;
+    }
+    size_t remaining = list->Size - *index;
+    node = list->tail;
+    while (remaining > node->count) {
+        remaining -= node->count;
+        node = node->previous;
+    }
+    *index = node->count - remaining;
+    return node;
+}
+
+/**
+ * @brief Remove the value at `offset` of `node`. A node which falls below half
+ * full takes values from its next node, or absorbs it if both fit in one
+ * node. An empty node is released. O(nodeCapacity).
+ *
+ * @param list `this`.
+ * @param node Node of the element.
+ * @param offset Offset of the element in `node`.
+ */
+static void __UnrolledListRemove(UnrolledList *const restrict list,
+                                 UnrolledListNode *const node,
+                                 const size_t offset) {
+    const unsigned long elementSize = list->elementSize;
+    memmove(node->values + offset * elementSize,
+            node->values + (offset + 1) * elementSize,
+            (node->count - offset - 1) * elementSize);
+    node->count--;
+    list->Size--;
+    if (node->count == 0) {
+        __UnrolledListUnlink(list, node);
+        return;
+    }
+    UnrolledListNode *next = node->next;
+    if (node->count >= list->nodeCapacity / 2 || next == NULL) return;
+    if (node->count + next->count <= list->nodeCapacity) {
+        memcpy(node->values + node->count * elementSize, next->values,
+               next->count * elementSize);
+        node->count += next->count;
+        __UnrolledListUnlink(list, next);
+        return;
+    }
+    // Share values evenly, so neither node is left below half full.
+    const size_t moved = (next->count - node->count) / 2;
+    memcpy(node->values + node->count * elementSize, next->values,
+           moved * elementSize);
+    memmove(next->values, next->values + moved * elementSize,
+            (next->count - moved) * elementSize);
+    node->count += moved;
+    next->count -= moved;
+}
+
+void *UnrolledListGet(const UnrolledList *const restrict list,
+                      const size_t index) {
+    assert(list != NULL);
+    assert(index < list->Size);
+    size_t offset = index;
+    UnrolledListNode *node = __UnrolledListLocate(list, &offset);
+    return node->values + offset * list->elementSize;
+}
+
+void UnrolledListSet(UnrolledList *const restrict list, const size_t index,
+                     const void *const restrict value) {
+    assert(value != NULL);
+    memcpy(UnrolledListGet(list, index), value, list->elementSize);
+}
+
+void *UnrolledListBack(const UnrolledList *const restrict list) {
+    assert(list != NULL);
+    if (list->tail == NULL) return NULL;
+    return list->tail->values + (list->tail->count - 1) * list->elementSize;
+}
+
+void *UnrolledListFront(const UnrolledList *const restrict list) {
+    assert(list != NULL);
+    if (list->head == NULL) return NULL;
+    return list->head->values;
+}
+
+void UnrolledListPushBack(UnrolledList *const restrict list,
+                          const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    UnrolledListNode *node = list->tail;
+    if (node == NULL || node->count == list->nodeCapacity) {
+        node = __UnrolledListLink(list, list->tail);
+    }
+    memcpy(node->values + node->count * list->elementSize, value,
+           list->elementSize);
+    node->count++;
+    list->Size++;
+}
+
+void UnrolledListPopBack(UnrolledList *const restrict list) {
+    assert(list != NULL);
+    assert(list->Size > 0);
+    __UnrolledListRemove(list, list->tail, list->tail->count - 1);
+}
+
+void UnrolledListPushFront(UnrolledList *const restrict list,
+                           const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    UnrolledListNode *node = list->head;
+    if (node == NULL || node->count == list->nodeCapacity) {
+        node = __UnrolledListLink(list, NULL);
+    }
+    memmove(node->values + list->elementSize, node->values,
+            node->count * list->elementSize);
+    memcpy(node->values, value, list->elementSize);
+    node->count++;
+    list->Size++;
+}
+
+void UnrolledListPopFront(UnrolledList *const restrict list) {
+    assert(list != NULL);
+    assert(list->Size > 0);
+    __UnrolledListRemove(list, list->head, 0);
+}
+
+void UnrolledListInsert(UnrolledList *const restrict list, const size_t index,
+                        const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    assert(index <= list->Size);
+    if (index == list->Size) {
+        UnrolledListPushBack(list, value);
+        return;
+    }
+    if (index == 0) {
+        UnrolledListPushFront(list, value);
+        return;
+    }
+
+    const unsigned long elementSize = list->elementSize;
+    size_t offset = index;
+    UnrolledListNode *node = __UnrolledListLocate(list, &offset);
+    if (node->count == list->nodeCapacity) {
+        // Split a full node, moving its upper half into a new next node.
+        UnrolledListNode *next = __UnrolledListLink(list, node);
+        const size_t kept = node->count / 2;
+        next->count = node->count - kept;
+        memcpy(next->values, node->values + kept * elementSize,
+               next->count * elementSize);
+        node->count = kept;
+        if (offset > kept) {
+            offset -= kept;
+            node = next;
+        }
+    }
+    memmove(node->values + (offset + 1) * elementSize,
+            node->values + offset * elementSize,
+            (node->count - offset) * elementSize);
+    memcpy(node->values + offset * elementSize, value, elementSize);
+    node->count++;
+    list->Size++;
+}
+
+void UnrolledListErase(UnrolledList *const restrict list, const size_t index) {
+    assert(list != NULL);
+    assert(index < list->Size);
+    size_t offset = index;
+    UnrolledListNode *node = __UnrolledListLocate(list, &offset);
+    __UnrolledListRemove(list, node, offset);
+}
+
+size_t UnrolledListFind(const UnrolledList *const restrict list,
+                        const void *const restrict value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    size_t index = 0;
+    for (UnrolledListNode *node = list->head; node != NULL;
+         node = node->next) {
+        for (size_t i = 0; i < node->count; i++) {
+            if (list->compare(node->values + i * list->elementSize, value) ==
+                0) {
+                return index + i;
+            }
+        }
+        index += node->count;
+    }
+    return -1;
+}
+
+UnrolledListIterator UnrolledListGetIterator(
+    UnrolledList *const restrict list) {
+    assert(list != NULL);
+    UnrolledListIterator iterator = {list->head, 0, list->elementSize};
+    return iterator;
+}
+
+UnrolledListIterator UnrolledListGetReverseIterator(
+    UnrolledList *const restrict list) {
+    assert(list != NULL);
+    UnrolledListIterator iterator = {
+        list->tail, list->tail != NULL ? list->tail->count - 1 : 0,
+        list->elementSize};
+    return iterator;
+}
+
+UnrolledListIterator UnrolledListIteratorNext(
+    UnrolledListIterator const iterator) {
+    assert(iterator.node != NULL);
+    if (iterator.index + 1 < iterator.node->count) {
+        UnrolledListIterator i = {iterator.node, iterator.index + 1,
+                                  iterator.elementSize};
+        return i;
+    }
+    UnrolledListIterator i = {iterator.node->next, 0, iterator.elementSize};
+    return i;
+}
+
+UnrolledListIterator UnrolledListIteratorPrevious(
+    UnrolledListIterator const iterator) {
+    assert(iterator.node != NULL);
+    if (iterator.index > 0) {
+        UnrolledListIterator i = {iterator.node, iterator.index - 1,
+                                  iterator.elementSize};
+        return i;
+    }
+    UnrolledListNode *previous = iterator.node->previous;
+    UnrolledListIterator i = {previous,
+                              previous != NULL ? previous->count - 1 : 0,
+                              iterator.elementSize};
+    return i;
+}
+
+void *UnrolledListIteratorGetValue(UnrolledListIterator const iterator) {
+    assert(iterator.node != NULL);
+    return iterator.node->values + iterator.index * iterator.elementSize;
+}
+
+Bool UnrolledListIteratorEnded(UnrolledListIterator const iterator) {
+    return iterator.node == NULL;
+}
@@ -0,0 +1,299 @@
+#ifndef __COLLECTIONS_UNROLLED_LIST__
+#define __COLLECTIONS_UNROLLED_LIST__
+
+#include "types.h"
+
+/**
+ * @brief Type of node in `UnrolledList`. Up to `nodeCapacity` values of the
+ * list are stored contiguously in one node.
+ * @attention It is no recommended to use this struct.
+ * @see `UnrolledListGetIterator()`, `UnrolledListGetReverseIterator()`.
+ */
+typedef struct __UnrolledListNode {
+    /**
+     * @private
+     * @brief Pointer refers to the previous node.
+     */
+    struct __UnrolledListNode *previous;
+    /**
+     * @private
+     * @brief Pointer refers to the next node.
+     */
+    struct __UnrolledListNode *next;
+    /**
+     * @private
+     * @brief Count of values stored in this node. Its width also keeps
+     * `values` aligned to 8 bytes.
+     */
+    size_t count;
+    /**
+     * @private
+     * @brief Values of this node.
+     */
+    unsigned char values[];
+} UnrolledListNode;
+
+/**
+ * @brief Iterator of `UnrolledList`.
+ * @attention This iterator has no void head node. You can call
+ * `UnrolledListIteratorGetValue()` directly.
+ */
+typedef struct {
+    UnrolledListNode *node;
+    size_t index;
+    unsigned long elementSize;
+} UnrolledListIterator;
+
+/**
+ * @brief Doubly linked list whose nodes hold a small array of elements each,
+ * so that traversal reads contiguous memory and allocations are shared by
+ * many elements. A full node is split in half on insertion, and a node which
+ * falls below half full after removal is merged with or refilled from its
+ * next node.
+ * @warning Don't initialize or free instance of this struct directly. Please
+ * use functions below.
+ * @see `UnrolledListConstruct()`, `UnrolledListNew()`,
+ * `UnrolledListDestruct()`, `UnrolledListDelete()`.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Pointer refers to the first node.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `UnrolledListFront()`, `UnrolledListPushFront()`,
+     * `UnrolledListPopFront()`.
+     */
+    UnrolledListNode *head;
+    /**
+     * @private
+     * @brief Pointer refers to the last node.
+     * @warning Don't modify this member directly. Please use functions below.
+     * @see `UnrolledListBack()`, `UnrolledListPushBack()`,
+     * `UnrolledListPopBack()`.
+     */
+    UnrolledListNode *tail;
+    /**
+     * @private
+     * @brief Element size of this list.
+     * @warning Don't modify this member directly.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Maximum count of values in one node. Nodes span a few cache
+     * lines whatever the element size is, but hold at least 4 values.
+     * @warning Don't modify this member directly.
+     */
+    unsigned int nodeCapacity;
+    /**
+     * @private
+     * @brief Functions used in comparing two elements.
+     * @warning Don't modify this member directly.
+     */
+    CompareFunction *compare;
+
+    /**
+     * @public
+     * @brief Current element quantity of this list.
+     * @attention Don't modify the value of this member directly. It is
+     * maintained automatically.
+     */
+    size_t Size;
+} UnrolledList;
+
+/**
+ * @brief Construct function. O(1).
+ *
+ * @param list Target to be constructed.
+ * @param elementSize Element size of `list`
+ * @param compare Function used in comparing two elements.
+ */
+void UnrolledListConstruct(UnrolledList *const restrict list,
+                           const unsigned long elementSize,
+                           CompareFunction *const compare);
+
+/**
+ * @brief Allocate a new list in heap. O(1).
+ *
+ * @param elementSize Element size of list.
+ * @param compare Function used in comparing two elements.
+ * @return UnrolledList* Pointer refering to a heap address.
+ */
+UnrolledList *UnrolledListNew(const unsigned long elementSize,
+                              CompareFunction *const compare);
+
+/**
+ * @brief Destruct function. O(n).
+ *
+ * @param list Target to be destructed. If `NULL`, nothing will happen.
+ */
+void UnrolledListDestruct(UnrolledList *const restrict list);
+
+/**
+ * @brief Release `list` in heap. O(n).
+ *
+ * @param list Pointer refers to the target which is to be deleted. The target
+ * will be set to `NULL`. If `NULL`, nothing will happen.
+ */
+void UnrolledListDelete(UnrolledList **const restrict list);
+
+/**
+ * @brief Get value of the element at specified `index`. Nodes are walked from
+ * the nearer end. O(n / nodeCapacity).
+ * @attention The returned value is shallow copied. Don't free it. It is
+ * invalidated by any insertion or removal.
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @return void* Value of element.
+ */
+void *UnrolledListGet(const UnrolledList *const restrict list,
+                      const size_t index);
+
+/**
+ * @brief Set value of element at specified `index`. O(n / nodeCapacity).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void UnrolledListSet(UnrolledList *const restrict list, const size_t index,
+                     const void *const restrict value);
+
+/**
+ * @brief Get value of the last element. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param list `this`.
+ * @return void* If `list` is empty, `NULL` will be returned.
+ */
+void *UnrolledListBack(const UnrolledList *const restrict list);
+
+/**
+ * @brief Get value of the first element. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param list `this`.
+ * @return void* If `list` is empty, `NULL` will be returned.
+ */
+void *UnrolledListFront(const UnrolledList *const restrict list);
+
+/**
+ * @brief Add new element at the end of `list`. O(1).
+ *
+ * @param list `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void UnrolledListPushBack(UnrolledList *const restrict list,
+                          const void *const restrict value);
+
+/**
+ * @brief Remove the last element of `list`. O(1).
+ *
+ * @param list `this`.
+ */
+void UnrolledListPopBack(UnrolledList *const restrict list);
+
+/**
+ * @brief Add new element at the begin of `list`. O(nodeCapacity).
+ *
+ * @param list `this`.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void UnrolledListPushFront(UnrolledList *const restrict list,
+                           const void *const restrict value);
+
+/**
+ * @brief Remove the first element of `list`. O(nodeCapacity).
+ *
+ * @param list `this`.
+ */
+void UnrolledListPopFront(UnrolledList *const restrict list);
+
+/**
+ * @brief Add new element at the specified index of `list`. After element
+ * added, `list[index]` will be the new element. O(n / nodeCapacity +
+ * nodeCapacity).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ * @param value Value of element. It will be DEEP copied.
+ */
+void UnrolledListInsert(UnrolledList *const restrict list, const size_t index,
+                        const void *const restrict value);
+
+/**
+ * @brief Remove the element at the specified index of `list`. O(n /
+ * nodeCapacity + nodeCapacity).
+ *
+ * @param list `this`.
+ * @param index Specified index.
+ */
+void UnrolledListErase(UnrolledList *const restrict list, const size_t index);
+
+/**
+ * @brief Find the element which has `value`. Values are compared node by
+ * node, in contiguous memory. O(n).
+ *
+ * @param list `this`.
+ * @param value Specified value.
+ * @return size_t If found, the index of the element will be returned. If not
+ * found, `(size_t)-1` will be returned.
+ */
+size_t UnrolledListFind(const UnrolledList *const restrict list,
+                        const void *const restrict value);
+
+/**
+ * @brief Get iterator of `list`. O(1).
+ *
+ * @param list `this`.
+ * @return UnrolledListIterator Iterator.
+ */
+UnrolledListIterator UnrolledListGetIterator(
+    UnrolledList *const restrict list);
+
+/**
+ * @brief Get reverse iterator of `list`. O(1).
+ *
+ * @param list `this`
+ * @return UnrolledListIterator Iterator.
+ */
+UnrolledListIterator UnrolledListGetReverseIterator(
+    UnrolledList *const restrict list);
+
+/**
+ * @brief Move to the next element. O(1).
+ *
+ * @param iterator `this`.
+ * @return UnrolledListIterator Renewed iterator.
+ */
+UnrolledListIterator UnrolledListIteratorNext(
+    UnrolledListIterator const iterator);
+
+/**
+ * @brief Move to the previous element. O(1).
+ *
+ * @param iterator `this`.
+ * @return UnrolledListIterator Renewed iterator.
+ */
+UnrolledListIterator UnrolledListIteratorPrevious(
+    UnrolledListIterator const iterator);
+
+/**
+ * @brief Get value of current element. O(1).
+ * @attention The returned value is shallow copied. Don't free it.
+ *
+ * @param iterator `this`.
+ * @return void* Value of element.
+ */
+void *UnrolledListIteratorGetValue(UnrolledListIterator const iterator);
+
+/**
+ * @brief Check if iterator reaches end. O(1).
+ *
+ * @param iterator `this`.
+ * @return Bool.
+ */
+Bool UnrolledListIteratorEnded(UnrolledListIterator const iterator);
+
+#endif  // __COLLECTIONS_UNROLLED_LIST__
@@ -7,10 +7,18 @@
 #include "array-stack.h"
 #include "avl-tree.h"
 #include "delinked-list.h"
+#include "gap-buffer.h"
 #include "linked-heap.h"
 #include "linked-list.h"
 #include "linked-queue.h"
 #include "linked-stack.h"
+#include "min-max-heap.h"
+#include "primitive-search.h"
 #include "priority-queue.h"
+#include "radix-heap.h"
+#include "segmented-list.h"
+#include "timer-wheel.h"
+#include "top-k-heap.h"
+#include "unrolled-list.h"
 
 #endif  // __COLLECTIONS__
\ No newline at end of file
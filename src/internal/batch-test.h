@@ -0,0 +1,104 @@
+#ifndef __COLLECTIONS_BATCH_TEST__
+#define __COLLECTIONS_BATCH_TEST__
+
+#include <memory.h>
+
+#include "types.h"
+
+/**
+ * @private
+ * @brief Get the mask of bits which a batch test of `count` values may set.
+ * O(1).
+ *
+ * @param count Value count passed to the batch test.
+ * @return unsigned long long Mask with the low `count` bits set.
+ */
+static inline unsigned long long __BatchTestMask(const unsigned int count) {
+    return count == 64 ? ~0ULL : (1ULL << count) - 1;
+}
+
+/**
+ * @private
+ * @brief Check whether the result of a batch test decides `Some` or `All`.
+ * O(1).
+ *
+ * @param mask Bitmask returned by the batch test.
+ * @param count Value count passed to the batch test.
+ * @param some If `TRUE`, a set bit decides. Otherwise, a clear bit decides.
+ * @return Bool
+ */
+static inline Bool __BatchTestDecided(const unsigned long long mask,
+                                      const unsigned int count,
+                                      const Bool some) {
+    const unsigned long long all = __BatchTestMask(count);
+    return some ? (mask & all) != 0 : (mask & all) != all;
+}
+
+/**
+ * @private
+ * @brief Values gathered from a container whose elements are not contiguous,
+ * waiting to be passed into a batch test together.
+ */
+typedef struct {
+    /**
+     * @private
+     * @brief Room for 64 values.
+     */
+    void *values;
+    /**
+     * @private
+     * @brief Count of gathered values.
+     */
+    unsigned int count;
+    /**
+     * @private
+     * @brief Size of each value.
+     */
+    unsigned long elementSize;
+    /**
+     * @private
+     * @brief Batch test function.
+     */
+    BatchTestFunction *test;
+    /**
+     * @private
+     * @brief If `TRUE`, a set bit decides. Otherwise, a clear bit decides.
+     */
+    Bool some;
+} __BatchTestChunk;
+
+/**
+ * @private
+ * @brief Copy `value` into `chunk`, and pass the chunk into its batch test
+ * once it holds 64 values. O(1).
+ *
+ * @param chunk Chunk being filled.
+ * @param value Value to be gathered.
+ * @return Bool Whether the test of a full chunk decided the result.
+ */
+static inline Bool __BatchTestChunkPush(__BatchTestChunk *const chunk,
+                                        const void *const value) {
+    memcpy(chunk->values + chunk->count * chunk->elementSize, value,
+           chunk->elementSize);
+    chunk->count++;
+    if (chunk->count < 64) return FALSE;
+    chunk->count = 0;
+    return __BatchTestDecided(chunk->test(chunk->values, 64), 64, chunk->some);
+}
+
+/**
+ * @private
+ * @brief Pass the values left in `chunk` into its batch test. O(1).
+ *
+ * @param chunk Chunk being filled.
+ * @return Bool Whether the test decided the result.
+ */
+static inline Bool __BatchTestChunkFlush(__BatchTestChunk *const chunk) {
+    const unsigned int count = chunk->count;
+    if (count == 0) return FALSE;
+    chunk->count = 0;
+    return __BatchTestDecided(chunk->test(chunk->values, count), count,
+                              chunk->some);
+}
+
+#endif  // __COLLECTIONS_BATCH_TEST__
@@ -1,6 +1,8 @@
 #ifndef __COLLECTIONS_TYPES__
 #define __COLLECTIONS_TYPES__
 
+#include <stddef.h>
+
 typedef enum { FALSE = 0, TRUE = 1 } Bool;
 
 /**
@@ -20,4 +22,27 @@ typedef int CompareFunction(const void *, const void *);
  */
 typedef Bool TestFunction(const void *);
 
+/**
+ * @brief Determine which of `count` contiguous values satisfy some
+ * conditions. `count` is between 1 and 64. One call covers a whole run, so
+ * the test can be vectorized.
+ *
+ * @return unsigned long long Bit `i` should be set if and only if the `i`th
+ * value satisfies conditions.
+ */
+typedef unsigned long long BatchTestFunction(const void *, unsigned int);
+
+/**
+ * @brief Extract the sort key of a value.
+ *
+ * @return unsigned long long Raw bits of the key. Only the low bytes
+ * requested by the caller are read.
+ */
+typedef unsigned long long KeyFunction(const void *);
+
+/**
+ * @brief Do something with a value.
+ */
+typedef void VisitFunction(void *);
+
 #endif  // __COLLECTIONS_TYPES__
@@ -0,0 +1,43 @@
+#include "common.h"
+
+int main() {
+    ArrayHeap *heap = ArrayHeapNew(3, sizeof(Test), compare);
+    ArrayHeapSetIncremental(heap, TRUE);
+
+    // Sifting works while elements are split between two storages.
+    unsigned int maximum = 0;
+    for (int i = 0; i < 1000; i++) {
+        Test test = {(i * 7919) % 1000, 0, 0};
+        ArrayHeapPush(heap, &test);
+        if (test.a > maximum) maximum = test.a;
+        if (((Test *)ArrayHeapTop(heap))->a != maximum) error(&heap, i);
+    }
+    if (heap->Size != 1000) error(&heap, 0);
+    for (unsigned int i = 0; i < 500; i++) {
+        Test *temp = (Test *)ArrayHeapTop(heap);
+        if (temp->a != 999 - i) error(&heap, i);
+        ArrayHeapPop(heap);
+    }
+
+    // Pushing past the capacity again starts a new migration.
+    for (int i = 0; i < 1000; i++) {
+        Test test = {1000 + i, 0, 0};
+        ArrayHeapPush(heap, &test);
+    }
+    Test output;
+    ArrayHeapPushPop(heap, &(Test){5000, 0, 0}, &output);
+    if (output.a != 5000) error(&heap, 0);
+    ArrayHeapReplaceTop(heap, &(Test){500, 0, 0});
+    for (unsigned int i = 0; i < 999; i++) {
+        ArrayHeapPopInto(heap, &output);
+        if (output.a != 1998 - i) error(&heap, i);
+    }
+    for (unsigned int i = 0; i < 501; i++) {
+        ArrayHeapPopInto(heap, &output);
+        if (output.a != 500 - i) error(&heap, i);
+    }
+    if (heap->Size != 0) error(&heap, 0);
+
+    ArrayHeapDelete(&heap);
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include "common.h"
+
+int main() {
+    ArrayHeap *heap = ArrayHeapNew(10, sizeof(Test), compare);
+    Test output;
+    for (int i = 0; i < 25; i++) {
+        Test test = {i * 2, i + 1, i + 2};
+        ArrayHeapPush(heap, &test);
+    }
+    // value larger than the top is returned immediately
+    Test larger = {100, 0, 0};
+    ArrayHeapPushPop(heap, &larger, &output);
+    if (output.a != 100 || heap->Size != 25) error(&heap, 0);
+    // otherwise the top is returned and value is kept
+    Test smaller = {47, 0, 0};
+    ArrayHeapPushPop(heap, &smaller, &output);
+    if (output.a != 48 || heap->Size != 25) error(&heap, 1);
+    Test replaced = {1, 0, 0};
+    ArrayHeapReplaceTop(heap, &replaced);
+    if (((Test *)ArrayHeapTop(heap))->a != 46) error(&heap, 2);
+    unsigned int expected[] = {46, 44, 42};
+    for (unsigned int i = 0; i < 3; i++) {
+        ArrayHeapPopInto(heap, &output);
+        if (output.a != expected[i]) error(&heap, i + 3);
+    }
+    ArrayHeapDelete(&heap);
+    return 0;
+}
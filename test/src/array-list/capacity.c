@@ -0,0 +1,42 @@
+#include "common.h"
+
+int main() {
+    ArrayList *list = ArrayListNew(1, sizeof(Test), compare);
+    ArrayListReserve(list, 64);
+    if (list->Capacity != 64) error(&list, 0);
+
+    // Growing in place keeps every element, wherever it is inserted.
+    for (unsigned int i = 0; i < 200; i++) {
+        Test test = {i, 0, 0};
+        if (i % 2 == 0) {
+            ArrayListPushBack(list, &test);
+        } else {
+            ArrayListInsert(list, list->Size / 2, &test);
+        }
+    }
+    if (list->Size != 200 || list->Capacity != 256) error(&list, 0);
+    ArrayListShrinkToFit(list);
+    if (list->Capacity != 200) error(&list, 0);
+    Test test = {1000, 0, 0};
+    ArrayListPushFront(list, &test);
+    if (list->Capacity != 400 || ((Test *)ArrayListFront(list))->a != 1000)
+        error(&list, 0);
+
+    // Without auto-shrink the capacity is kept.
+    ArrayListErase(list, 0, 50);
+    if (list->Capacity != 400) error(&list, 0);
+
+    // With it, capacity halves once a quarter or less is used.
+    ArrayListSetAutoShrink(list, TRUE);
+    ArrayListErase(list, 0, 1);
+    if (list->Capacity != 400) error(&list, 0);
+    while (list->Size > 100) ArrayListPopBack(list);
+    if (list->Capacity != 200) error(&list, 0);
+    ArrayListPopFront(list);
+    if (list->Capacity != 200) error(&list, 0);
+    while (list->Size > 0) ArrayListPopBack(list);
+    if (list->Capacity != 1) error(&list, 0);
+
+    ArrayListDelete(&list);
+    return 0;
+}
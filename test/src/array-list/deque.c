@@ -0,0 +1,74 @@
+#include "common.h"
+
+int main() {
+    ArrayList *list = ArrayListNew(8, sizeof(Test), compare);
+
+    // A sliding window reuses the slots freed at the front.
+    for (unsigned int i = 0; i < 10000; i++) {
+        Test test = {i, 0, 0};
+        ArrayListPushBack(list, &test);
+        if (list->Size > 100) ArrayListPopFront(list);
+        if (((Test *)ArrayListFront(list))->a != (i < 100 ? 0 : i - 99))
+            error(&list, i);
+    }
+    if (list->Capacity > 256) error(&list, 0);
+    for (unsigned int i = 0; i < 100; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != 9900 + i) error(&list, i);
+    }
+
+    // Pushes at the front leave room on both sides.
+    while (list->Size > 0) ArrayListPopBack(list);
+    for (unsigned int i = 0; i < 1000; i++) {
+        Test test = {i, 0, 0};
+        if (i % 2 == 0) {
+            ArrayListPushFront(list, &test);
+        } else {
+            ArrayListPushBack(list, &test);
+        }
+    }
+    for (unsigned int i = 0; i < 1000; i++) {
+        const unsigned int expected = i < 500 ? 998 - i * 2 : i * 2 - 999;
+        if (((Test *)ArrayListGet(list, i))->a != expected) error(&list, i);
+    }
+
+    // Inserts and erases near either end shift the shorter side.
+    ArrayListInsert(list, 1, &(Test){5000, 0, 0});
+    ArrayListInsert(list, list->Size - 1, &(Test){6000, 0, 0});
+    Test values[3] = {{7000, 0, 0}, {7001, 0, 0}, {7002, 0, 0}};
+    ArrayListInsertRange(list, 2, values, 3);
+    if (list->Size != 1005 || ((Test *)ArrayListGet(list, 0))->a != 998 ||
+        ((Test *)ArrayListGet(list, 1))->a != 5000 ||
+        ((Test *)ArrayListGet(list, 4))->a != 7002 ||
+        ((Test *)ArrayListGet(list, 5))->a != 996 ||
+        ((Test *)ArrayListGet(list, 1003))->a != 6000 ||
+        ((Test *)ArrayListGet(list, 1004))->a != 999)
+        error(&list, 0);
+    ArrayListErase(list, 1, 4);
+    ArrayListErase(list, list->Size - 2, 1);
+    for (unsigned int i = 0; i < 1000; i++) {
+        const unsigned int expected = i < 500 ? 998 - i * 2 : i * 2 - 999;
+        if (((Test *)ArrayListGet(list, i))->a != expected) error(&list, i);
+    }
+
+    ArrayListQuickSort(list);
+    for (unsigned int i = 0; i < 1000; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i) error(&list, i);
+    }
+    ArrayListShrinkToFit(list);
+    if (list->Capacity != 1000) error(&list, 0);
+
+    // Incremental growth doesn't carry the free slots at the front over.
+    ArrayListSetIncremental(list, TRUE);
+    for (unsigned int i = 0; i < 10000; i++) {
+        Test test = {1000 + i, 0, 0};
+        ArrayListPushBack(list, &test);
+        ArrayListPopFront(list);
+    }
+    if (list->Capacity > 2000) error(&list, 0);
+    for (unsigned int i = 0; i < 1000; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != 10000 + i) error(&list, i);
+    }
+
+    ArrayListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "common.h"
+
+static Bool odd(const void *value) { return ((const Test *)value)->a % 2; }
+
+int main() {
+    ArrayList *list = ArrayListNew(4, sizeof(Test), compare);
+    Test tests[30];
+    for (unsigned int i = 0; i < 30; i++) {
+        Test test = {i, i + 1, i + 2};
+        tests[i] = test;
+    }
+    // Insert 10..29 first, then 0..9 in front of them.
+    ArrayListInsertRange(list, 0, tests + 10, 20);
+    ArrayListInsertRange(list, 0, tests, 10);
+    ArrayListInsertRange(list, 30, tests, 0);
+    if (list->Size != 30 || list->Sorted) error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i) error(&list, i);
+    }
+
+    ArrayListInsertRange(list, 5, tests, 2);
+    if (list->Sorted) error(&list, 5);
+    ArrayListErase(list, 5, 2);
+    ArrayListErase(list, 25, 5);
+    ArrayListErase(list, 0, 0);
+    if (list->Size != 25) error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i) error(&list, i);
+    }
+
+    if (ArrayListRemoveIf(list, odd) != 12 || list->Size != 13)
+        error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)ArrayListGet(list, i);
+        if (temp->a != i * 2 || temp->c != i * 2 + 2) error(&list, i);
+    }
+    ArrayListDelete(&list);
+    return 0;
+}
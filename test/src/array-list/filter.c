@@ -0,0 +1,27 @@
+#include "common.h"
+
+static unsigned long long even(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a % 2 == 0) << i;
+    }
+    return mask;
+}
+
+int main() {
+    ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+    for (unsigned int i = 0; i < 150; i++) {
+        Test test = {i, i + 1, i + 2};
+        ArrayListPushBack(list, &test);
+    }
+    ArrayList *result = ArrayListFilter(list, even);
+    if (result->Size != 75) error(&result, 0);
+    for (unsigned int i = 0; i < result->Size; i++) {
+        Test *temp = (Test *)ArrayListGet(result, i);
+        if (temp->a != i * 2 || temp->b != i * 2 + 1) error(&result, i);
+    }
+    ArrayListDelete(&result);
+    ArrayListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "common.h"
+
+static unsigned long long even(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a % 2 == 0) << i;
+    }
+    return mask;
+}
+
+int main() {
+    ArrayList *list = ArrayListNew(4, sizeof(Test), compare);
+    ArrayListSetIncremental(list, TRUE);
+
+    // Elements stay readable while they are being moved to new storage.
+    for (unsigned int i = 0; i < 1000; i++) {
+        Test test = {i, 0, 0};
+        ArrayListPushBack(list, &test);
+        if (((Test *)ArrayListBack(list))->a != i) error(&list, i);
+        for (unsigned int j = 0; j <= i; j += 7) {
+            if (((Test *)ArrayListGet(list, j))->a != j) error(&list, j);
+        }
+    }
+    if (list->Capacity != 1024) error(&list, 0);
+
+    // Writes during a migration land where the element currently lives.
+    for (unsigned int i = 0; i < 24; i++) {
+        Test test = {1000 + i, 0, 0};
+        ArrayListPushBack(list, &test);
+    }
+    for (unsigned int i = 0; i < 1024; i++) {
+        Test test = {i * 2, 0, 0};
+        ArrayListSet(list, i, &test);
+    }
+    Test test = {0, 0, 0};
+    ArrayListPushBack(list, &test);
+    ArrayListPopBack(list);
+    for (unsigned int i = 0; i < 1024; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i * 2) error(&list, i);
+    }
+    if (ArrayListFind(list, &(Test){2046, 0, 0}) != 1023) error(&list, 0);
+
+    // Popping past the pending elements finishes the migration early.
+    for (unsigned int i = 0; i < 1024; i++) ArrayListPushBack(list, &test);
+    while (list->Size > 10) ArrayListPopBack(list);
+    for (unsigned int i = 0; i < 10; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i * 2) error(&list, i);
+    }
+
+    // Any other operation settles the list first.
+    for (unsigned int i = 0; i < 2100; i++) ArrayListPushBack(list, &test);
+    ArrayListPushFront(list, &test);
+    ArrayListErase(list, 0, 1);
+    Test *front = ArrayListFront(list);
+    for (unsigned int i = 0; i < 10; i++) {
+        if (front[i].a != i * 2) error(&list, i);
+    }
+    ArrayListSetIncremental(list, FALSE);
+    ArrayListDelete(&list);
+
+    // Reads through a pointer to const don't finish the migration.
+    list = ArrayListNew(64, sizeof(Test), compare);
+    ArrayListSetIncremental(list, TRUE);
+    for (unsigned int i = 0; i < 65; i++) {
+        Test test = {i * 2, 0, 0};
+        ArrayListPushBack(list, &test);
+    }
+    if (list->previous == NULL) error(&list, 0);
+    // Elements were pushed in ascending order.
+    list->Sorted = TRUE;
+    const ArrayList *reader = list;
+    for (unsigned int i = 0; i < 65; i++) {
+        Test temp = {i * 2, 0, 0};
+        if (ArrayListFind(reader, &temp) != i) error(&list, i);
+        if (ArrayListLowerBound(reader, &temp) != i) error(&list, i);
+        if (ArrayListUpperBound(reader, &temp) != i + 1) error(&list, i);
+        temp.a++;
+        if (ArrayListLowerBound(reader, &temp) != i + 1) error(&list, i);
+    }
+    ArrayList *slice = ArrayListSlice(reader, 1, 63);
+    for (unsigned int i = 0; i < 63; i++) {
+        if (((Test *)slice->array)[i].a != i * 2 + 2) error(&slice, i);
+    }
+    ArrayList *filtered = ArrayListFilter(reader, even);
+    if (filtered->Size != 65) error(&filtered, 0);
+    for (unsigned int i = 0; i < 65; i++) {
+        if (((Test *)ArrayListGet(filtered, i))->a != i * 2)
+            error(&filtered, i);
+    }
+    if (list->previous == NULL) error(&list, 0);
+    ArrayListDelete(&filtered);
+    ArrayListDelete(&slice);
+    ArrayListDelete(&list);
+    return 0;
+}
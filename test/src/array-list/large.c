@@ -0,0 +1,43 @@
+#include "common.h"
+
+unsigned long long key(const void *const restrict value) {
+    return ((Test *)value)->a;
+}
+
+int main() {
+    // 1 << 26 elements of 12 bytes reserve 768 MiB of address space.
+    ArrayList *list = ArrayListNewLarge(1U << 26, sizeof(Test), compare);
+    const void *const front = list->array;
+    for (unsigned int i = 0; i < 1000000; i++) {
+        Test test = {(i * 7919ULL) % 1000000, i, 0};
+        ArrayListPushBack(list, &test);
+    }
+    // Growth commits pages in place instead of moving elements.
+    if (list->array != front || list->Capacity < list->Size) error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i += 997) {
+        if (((Test *)ArrayListGet(list, i))->b != i) error(&list, i);
+    }
+
+    ArrayListRadixSort(list, key, 4, ARRAY_LIST_KEY_UNSIGNED);
+    if (list->array != front) error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i) error(&list, i);
+    }
+
+    // Shrinking releases whole 2 MiB steps from the tail.
+    ArrayListErase(list, 1000, list->Size - 1000);
+    ArrayListShrinkToFit(list);
+    if (list->Capacity * sizeof(Test) > 2U << 20 ||
+        list->Capacity < list->Size)
+        error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        if (((Test *)ArrayListGet(list, i))->a != i) error(&list, i);
+    }
+    Test test = {1000, 0, 0};
+    ArrayListPushBack(list, &test);
+    ArrayListReserve(list, 1000000);
+    if (list->array != front || list->Capacity < 1000000) error(&list, 0);
+
+    ArrayListDelete(&list);
+    return 0;
+}
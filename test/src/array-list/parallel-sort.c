@@ -0,0 +1,35 @@
+#include "common.h"
+
+int main() {
+    const unsigned int sizes[] = {0, 1, 100, 50000, 100003};
+    const unsigned int threads[] = {1, 3, 4, 8};
+    for (unsigned int s = 0; s < 5; s++) {
+        for (unsigned int t = 0; t < 4; t++) {
+            for (unsigned int stable = 0; stable < 2; stable++) {
+                ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+                unsigned long sum = 0;
+                for (unsigned int i = 0; i < sizes[s]; i++) {
+                    Test test = {(i * 7919) % 1013, i, 0};
+                    ArrayListPushBack(list, &test);
+                    sum += i;
+                }
+                ArrayListParallelSort(list, threads[t], stable);
+                if (list->Size != sizes[s]) error(&list, 0);
+                for (unsigned int i = 0; i < list->Size; i++) {
+                    sum -= ((Test *)ArrayListGet(list, i))->b;
+                }
+                if (sum != 0) error(&list, 0);
+                for (unsigned int i = 1; i < list->Size; i++) {
+                    Test *former = (Test *)ArrayListGet(list, i - 1),
+                         *latter = (Test *)ArrayListGet(list, i);
+                    if (former->a > latter->a) error(&list, i);
+                    if (stable && former->a == latter->a &&
+                        former->b > latter->b)
+                        error(&list, i);
+                }
+                ArrayListDelete(&list);
+            }
+        }
+    }
+    return 0;
+}
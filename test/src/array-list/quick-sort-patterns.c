@@ -0,0 +1,43 @@
+#include "common.h"
+
+// Keys of each pattern: ascending, descending, all equal, few distinct,
+// organ pipe and pseudo random.
+unsigned int key(const unsigned int pattern, const unsigned int i) {
+    switch (pattern) {
+        case 0:
+            return i;
+        case 1:
+            return 1000 - i;
+        case 2:
+            return 7;
+        case 3:
+            return i % 4;
+        case 4:
+            return i < 500 ? i : 1000 - i;
+        default:
+            return (i * 7919) % 1009;
+    }
+}
+
+int main() {
+    for (unsigned int pattern = 0; pattern < 6; pattern++) {
+        ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+        ArrayListQuickSort(list);
+        unsigned long sum = 0;
+        for (unsigned int i = 0; i < 1000; i++) {
+            Test test = {key(pattern, i), i, 0};
+            ArrayListPushBack(list, &test);
+            sum += i;
+        }
+        ArrayListQuickSort(list);
+        for (unsigned int i = 0; i < list->Size; i++) {
+            Test *temp = (Test *)ArrayListGet(list, i);
+            sum -= temp->b;
+            if (i > 0 && ((Test *)ArrayListGet(list, i - 1))->a > temp->a)
+                error(&list, i);
+        }
+        if (list->Size != 1000 || sum != 0) error(&list, 0);
+        ArrayListDelete(&list);
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <memory.h>
+
+#include "common.h"
+
+unsigned long long unsignedKey(const void *const value) {
+    return ((const Test *)value)->a;
+}
+
+unsigned long long signedKey(const void *const value) {
+    return (unsigned long long)(long long)(int)((const Test *)value)->a;
+}
+
+unsigned long long floatingKey(const void *const value) {
+    float key = (float)(int)((const Test *)value)->a / 4;
+    unsigned int bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return bits;
+}
+
+int main() {
+    KeyFunction *keys[] = {unsignedKey, signedKey, floatingKey};
+    for (unsigned int type = 0; type < 3; type++) {
+        ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+        ArrayListRadixSort(list, keys[type], 4, type);
+        for (unsigned int i = 0; i < 1000; i++) {
+            // Unsigned keys are 0..99, other keys are -50..49.
+            unsigned int key = (i * 37) % 100;
+            if (type != ARRAY_LIST_KEY_UNSIGNED) key -= 50;
+            Test test = {key, i, 0};
+            ArrayListPushBack(list, &test);
+        }
+        ArrayListRadixSort(list, keys[type], 4, type);
+        if (list->Size != 1000) error(&list, 0);
+        for (unsigned int i = 1; i < list->Size; i++) {
+            Test *former = (Test *)ArrayListGet(list, i - 1),
+                 *latter = (Test *)ArrayListGet(list, i);
+            int order = type == ARRAY_LIST_KEY_UNSIGNED
+                            ? (former->a > latter->a) - (former->a < latter->a)
+                            : ((int)former->a > (int)latter->a) -
+                                  ((int)former->a < (int)latter->a);
+            if (order > 0 || (order == 0 && former->b > latter->b))
+                error(&list, i);
+        }
+        ArrayListDelete(&list);
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include "common.h"
+
+int main() {
+    ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+    if (list->Sorted) error(&list, 0);
+
+    // Insert keys 0, 2, ..., 98 in scrambled order, each twice.
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {((i * 37) % 50) * 2, i, 0};
+        unsigned int index = ArrayListInsertSorted(list, &test);
+        if (((Test *)ArrayListGet(list, index))->b != i) error(&list, index);
+    }
+    if (!list->Sorted || list->Size != 100) error(&list, 0);
+    for (unsigned int i = 1; i < list->Size; i++) {
+        Test *former = (Test *)ArrayListGet(list, i - 1),
+             *latter = (Test *)ArrayListGet(list, i);
+        if (former->a > latter->a ||
+            (former->a == latter->a && former->b > latter->b))
+            error(&list, i);
+    }
+
+    for (unsigned int key = 0; key < 101; key++) {
+        Test temp = {key, 0, 0};
+        unsigned int lower = ArrayListLowerBound(list, &temp),
+                     upper = ArrayListUpperBound(list, &temp);
+        if (lower != (key + 1) / 2 * 2) error(&list, lower);
+        Bool present = key % 2 == 0 && key < 100;
+        if (upper != (present ? lower + 2 : lower)) error(&list, upper);
+        if (ArrayListFind(list, &temp) != (present ? lower : (size_t)-1))
+            error(&list, key);
+    }
+
+    // Removals keep the flag.
+    ArrayListPopFront(list);
+    ArrayListPopBack(list);
+    ArrayListErase(list, 10, 5);
+    if (!list->Sorted) error(&list, 0);
+
+    // Additions clear it even if they keep the order, sorting sets it again.
+    Test test = {1000, 0, 0};
+    ArrayListPushBack(list, &test);
+    if (list->Sorted) error(&list, 0);
+    ArrayListQuickSort(list);
+    if (!list->Sorted) error(&list, 0);
+    test.a = 500;
+    ArrayListSet(list, 0, &test);
+    if (list->Sorted) error(&list, 0);
+
+    // An unsorted list is searched linearly.
+    if (ArrayListFind(list, &test) != 0) error(&list, 0);
+
+    ArrayListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "common.h"
+
+Bool isOdd(const void *const restrict value) {
+    return ((Test *)value)->a % 2 == 1;
+}
+
+int main() {
+    ArrayList *list = ArrayListNew(10, sizeof(Test), compare);
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {99 - i, 0, 0};
+        ArrayListPushBack(list, &test);
+    }
+
+    // Keys 79, 78, ..., 30 are viewed in place.
+    ArrayListView view = ArrayListGetView(list, 20, 50);
+    if (view.Size != 50 || view.Sorted) error(&list, 0);
+    if (ArrayListViewGet(view, 0) != ArrayListGet(list, 20)) error(&list, 20);
+    Test temp = {40, 0, 0};
+    if (ArrayListViewFind(view, &temp) != 39) error(&list, 39);
+    temp.a = 10;
+    if (ArrayListViewFind(view, &temp) != (size_t)-1) error(&list, 10);
+    if (!ArrayListViewSome(view, isOdd) || ArrayListViewAll(view, isOdd))
+        error(&list, 0);
+
+    ArrayListView inner = ArrayListViewGetView(view, 10, 1);
+    if (ArrayListViewAll(inner, isOdd) != TRUE) error(&list, 30);
+
+    unsigned int expected = 79;
+    for (ArrayListIterator i = ArrayListViewGetIterator(view);
+         !ArrayListIteratorEnded(i); i = ArrayListIteratorNext(i)) {
+        if (((Test *)ArrayListIteratorGetValue(i))->a != expected--)
+            error(&list, expected);
+    }
+    if (expected != 29) error(&list, expected);
+    for (ArrayListIterator i = ArrayListViewGetReverseIterator(view);
+         !ArrayListIteratorEnded(i); i = ArrayListIteratorPrevious(i)) {
+        if (((Test *)ArrayListIteratorGetValue(i))->a != ++expected)
+            error(&list, expected);
+    }
+
+    // Sorting the view only reorders the viewed range of the list.
+    ArrayListViewQuickSort(&view);
+    if (!view.Sorted || list->Sorted) error(&list, 0);
+    for (unsigned int i = 0; i < 100; i++) {
+        unsigned int key = i < 20 || i >= 70 ? 99 - i : i + 10;
+        if (((Test *)ArrayListGet(list, i))->a != key) error(&list, i);
+    }
+    temp.a = 55;
+    if (ArrayListViewFind(view, &temp) != 25) error(&list, 25);
+    if (ArrayListViewLowerBound(view, &temp) != 25 ||
+        ArrayListViewUpperBound(view, &temp) != 26)
+        error(&list, 25);
+    temp.a = 100;
+    if (ArrayListViewLowerBound(view, &temp) != 50) error(&list, 50);
+
+    ArrayListDelete(&list);
+    return 0;
+}
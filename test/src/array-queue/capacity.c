@@ -0,0 +1,36 @@
+#include "common.h"
+
+int main() {
+    ArrayQueue *queue = ArrayQueueNew(4, sizeof(Test));
+    ArrayQueueReserve(queue, 100);
+    if (queue->Capacity != 100) error(&queue, 0);
+    ArrayQueueShrinkToFit(queue);
+    if (queue->Capacity != 1) error(&queue, 0);
+
+    // A growth factor of 1.5 still makes progress from capacity 1.
+    ArrayQueueSetGrowthFactor(queue, 1.5);
+    ArrayQueueSetAutoShrink(queue, TRUE);
+    for (unsigned int i = 0; i < 1000; i++) {
+        Test test = {i, 0, 0};
+        ArrayQueuePush(queue, &test);
+    }
+    if (queue->Size != 1000 || queue->Capacity < 1000) error(&queue, 0);
+    const unsigned int peak = queue->Capacity;
+
+    // Capacity follows the size down after the burst.
+    for (unsigned int i = 0; i < 990; i++) {
+        if (((Test *)ArrayQueueFront(queue))->a != i) error(&queue, i);
+        ArrayQueuePop(queue);
+        if (queue->Capacity < queue->Size || queue->Capacity > peak)
+            error(&queue, i);
+    }
+    if (queue->Capacity >= 100) error(&queue, 0);
+    for (unsigned int i = 0; i < 10; i++) {
+        if (((Test *)ArrayQueueFront(queue))->a != 990 + i) error(&queue, i);
+        ArrayQueuePop(queue);
+    }
+    if (queue->Capacity != 1) error(&queue, 0);
+
+    ArrayQueueDelete(&queue);
+    return 0;
+}
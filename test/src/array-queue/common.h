@@ -10,9 +10,11 @@
 int error(ArrayQueue **const restrict queue, const unsigned int i) {
     unsigned int j = i;
     printf("Element Incorrect At [%d]\nArrayQueue:\n", j);
+    ArrayQueueIterator iterator = ArrayQueueGetIterator(*queue);
     for (unsigned int j = 0; j < (*queue)->Size; j++) {
-        Test *temp = (Test *)((*queue)->array + j * (*queue)->elementSize);
+        Test *temp = (Test *)ArrayQueueIteratorGetValue(iterator);
         printf("[%d]: { %d, %d, %d }\n", j, temp->a, temp->b, temp->c);
+        iterator = ArrayQueueIteratorNext(iterator);
     }
     ArrayQueueDelete(queue);
     exit(-1);
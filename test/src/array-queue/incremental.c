@@ -0,0 +1,57 @@
+#include "common.h"
+
+static unsigned int limit = 0;
+
+static unsigned long long below(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a < limit) << i;
+    }
+    return mask;
+}
+
+int main() {
+    ArrayQueue *queue = ArrayQueueNew(3, sizeof(Test));
+    ArrayQueueSetIncremental(queue, TRUE);
+
+    // Elements stay in order while they wrap around and move to new storage.
+    unsigned int front = 0, migrations = 0;
+    for (unsigned int i = 0; i < 3000; i++) {
+        Test test = {i, 0, 0};
+        ArrayQueuePush(queue, &test);
+        if (queue->previous != NULL) migrations++;
+        if (i % 3 == 0) {
+            if (((Test *)ArrayQueueFront(queue))->a != front) error(&queue, i);
+            ArrayQueuePop(queue);
+            front++;
+        }
+        if (queue->Size != i + 1 - front) error(&queue, i);
+
+        // Batches are split wherever the elements are not contiguous.
+        if (queue->Size < 2) continue;
+        limit = i + 1;
+        if (!ArrayQueueAllBatch(queue, below)) error(&queue, i);
+        limit = i;
+        if (!ArrayQueueSomeBatch(queue, below) ||
+            ArrayQueueAllBatch(queue, below))
+            error(&queue, i);
+        limit = front;
+        if (ArrayQueueSomeBatch(queue, below)) error(&queue, i);
+    }
+    if (migrations == 0) error(&queue, 0);
+
+    ArrayQueueIterator iterator = ArrayQueueGetIterator(queue);
+    if (queue->previous != NULL) error(&queue, 0);
+    for (unsigned int i = front; i < 3000; i++) {
+        if (((Test *)ArrayQueueIteratorGetValue(iterator))->a != i)
+            error(&queue, i);
+        iterator = ArrayQueueIteratorNext(iterator);
+    }
+    for (unsigned int i = front; i < 3000; i++) {
+        if (((Test *)ArrayQueueFront(queue))->a != i) error(&queue, i);
+        ArrayQueuePop(queue);
+    }
+    ArrayQueueDelete(&queue);
+    return 0;
+}
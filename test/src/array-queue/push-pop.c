@@ -12,6 +12,20 @@ int main() {
             error(&queue, i);
         ArrayQueuePop(queue);
     }
+
+    // Steady pushes and pops wrap around without growing the storage.
+    for (unsigned int i = 0; i < 5; i++) {
+        Test test = {i, 0, 0};
+        ArrayQueuePush(queue, &test);
+    }
+    const size_t capacity = queue->Capacity;
+    for (unsigned int i = 5; i < 1000; i++) {
+        Test test = {i, 0, 0};
+        ArrayQueuePush(queue, &test);
+        if (((Test *)ArrayQueueFront(queue))->a != i - 5) error(&queue, i);
+        ArrayQueuePop(queue);
+    }
+    if (queue->Size != 5 || queue->Capacity != capacity) error(&queue, 0);
     ArrayQueueDelete(&queue);
     return 0;
 }
@@ -0,0 +1,31 @@
+#include "common.h"
+
+static unsigned int limit = 0;
+
+static unsigned long long below(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a < limit) << i;
+    }
+    return mask;
+}
+
+int main() {
+    ArrayQueue *queue = ArrayQueueNew(10, sizeof(Test));
+    if (ArrayQueueSomeBatch(queue, below) || !ArrayQueueAllBatch(queue, below))
+        error(&queue, 0);
+    for (unsigned int i = 0; i < 150; i++) {
+        Test test = {i, i + 1, i + 2};
+        ArrayQueuePush(queue, &test);
+    }
+    limit = 0;
+    if (ArrayQueueSomeBatch(queue, below)) error(&queue, 0);
+    limit = 150;
+    if (!ArrayQueueAllBatch(queue, below)) error(&queue, 0);
+    limit = 149;
+    if (!ArrayQueueSomeBatch(queue, below) || ArrayQueueAllBatch(queue, below))
+        error(&queue, 149);
+    ArrayQueueDelete(&queue);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "common.h"
+
+static unsigned long long small(const void *values, unsigned int count) {
+    const AvlMapPair *pairs = (const AvlMapPair *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(((Test *)pairs[i].value)->a < 100) << i;
+    }
+    return mask;
+}
+
+int main() {
+    AvlMap *map = AvlMapNew(sizeof(int), sizeof(Test));
+    for (int i = 0; i < 100; i++) {
+        Test test = {i, i + 1, i + 2};
+        AvlMapSet(map, &i, &test);
+    }
+    if (!AvlMapAllBatch(map, small)) error(&map, 0);
+    int key = 100;
+    Test test = {100, 101, 102};
+    AvlMapSet(map, &key, &test);
+    if (!AvlMapSomeBatch(map, small) || AvlMapAllBatch(map, small))
+        error(&map, 100);
+    AvlMapDelete(&map);
+    return 0;
+}
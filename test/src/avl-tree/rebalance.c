@@ -0,0 +1,50 @@
+#include "common.h"
+
+static unsigned int check(AvlTree **const restrict tree,
+                          AvlTreeNode *const restrict node) {
+    if (node == NULL) return 0;
+    Test *temp = (Test *)node->value;
+    if (node->left != NULL && node->left->parent != node)
+        error(tree, temp->a);
+    if (node->right != NULL && node->right->parent != node)
+        error(tree, temp->a);
+    unsigned int left = check(tree, node->left);
+    unsigned int right = check(tree, node->right);
+    if (left > right + 1 || right > left + 1) error(tree, temp->a);
+    if (node->height != (left > right ? left : right) + 1)
+        error(tree, temp->a);
+    return node->height;
+}
+
+static unsigned int inorder(AvlTree **const restrict tree,
+                            AvlTreeNode *const restrict node,
+                            const unsigned int i) {
+    if (node == NULL) return i;
+    unsigned int index = inorder(tree, node->left, i);
+    if (((Test *)node->value)->a != index) error(tree, index);
+    return inorder(tree, node->right, index + 1);
+}
+
+int main() {
+    AvlTree *tree = AvlTreeNew(sizeof(Test), compare);
+    // Zigzag keys need the left-right and right-left double rotations.
+    unsigned int keys[] = {30, 10, 20, 40, 60, 50};
+    for (unsigned int i = 0; i < 6; i++) {
+        Test test = {keys[i], 0, 0};
+        AvlTreeInsert(tree, &test);
+        check(&tree, tree->root);
+    }
+    if (tree->root->parent != NULL) error(&tree, 0);
+    AvlTreeDelete(&tree);
+
+    tree = AvlTreeNew(sizeof(Test), compare);
+    for (unsigned int i = 0; i < 500; i++) {
+        Test test = {(i * 37) % 500, 0, 0};
+        AvlTreeInsert(tree, &test);
+        check(&tree, tree->root);
+    }
+    if (tree->root->parent != NULL) error(&tree, 0);
+    if (inorder(&tree, tree->root, 0) != 500) error(&tree, 500);
+    AvlTreeDelete(&tree);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "common.h"
+
+static unsigned int limit = 0;
+
+static unsigned long long below(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a < limit) << i;
+    }
+    return mask;
+}
+
+int main() {
+    AvlTree *tree = AvlTreeNew(sizeof(Test), compare);
+    if (AvlTreeSomeBatch(tree, below) || !AvlTreeAllBatch(tree, below))
+        error(&tree, 0);
+    for (unsigned int i = 0; i < 150; i++) {
+        Test test = {(i * 37) % 150, 0, 0};
+        AvlTreeInsert(tree, &test);
+    }
+    limit = 0;
+    if (AvlTreeSomeBatch(tree, below)) error(&tree, 0);
+    limit = 150;
+    if (!AvlTreeAllBatch(tree, below)) error(&tree, 0);
+    limit = 149;
+    if (!AvlTreeSomeBatch(tree, below) || AvlTreeAllBatch(tree, below))
+        error(&tree, 149);
+    AvlTreeDelete(&tree);
+    return 0;
+}
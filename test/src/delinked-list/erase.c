@@ -0,0 +1,68 @@
+#include "common.h"
+
+int main() {
+    DelinkedList *list = DelinkedListNew(sizeof(Test), compare);
+    for (unsigned int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        DelinkedListPushBack(list, &test);
+    }
+    // Remove odd elements while iterating.
+    DelinkedListIterator iterator = DelinkedListGetIterator(list);
+    while (!DelinkedListIteratorEnded(iterator)) {
+        if (((Test *)DelinkedListIteratorGetValue(iterator))->a % 2 == 1) {
+            iterator = DelinkedListErase(list, iterator);
+        } else {
+            iterator = DelinkedListIteratorNext(iterator);
+        }
+    }
+    if (list->Size != 13) error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)DelinkedListGet(list, i);
+        if (temp->a != i * 2 || temp->b != i * 2 + 1) error(&list, i);
+    }
+
+    // Put them back around even elements.
+    iterator = DelinkedListGetIterator(list);
+    while (!DelinkedListIteratorEnded(iterator)) {
+        unsigned int a = ((Test *)DelinkedListIteratorGetValue(iterator))->a;
+        if (a > 0) {
+            Test test = {a - 1, a, a + 1};
+            DelinkedListInsertBefore(list, iterator, &test);
+        }
+        iterator = DelinkedListIteratorNext(iterator);
+    }
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)DelinkedListGet(list, i);
+        if (temp->a != i || temp->b != i + 1 || temp->c != i + 2)
+            error(&list, i);
+    }
+
+    // Ended iterators insert at the begin or the end.
+    Test test = {100, 0, 0};
+    iterator = DelinkedListInsertBefore(list, NULL, &test);
+    if (DelinkedListGetReverseIterator(list) != iterator) error(&list, 25);
+    test.a = 200;
+    iterator = DelinkedListInsertAfter(list, NULL, &test);
+    if (DelinkedListGetIterator(list) != iterator) error(&list, 0);
+    test.a = 300;
+    iterator = DelinkedListInsertAfter(list, DelinkedListGetIterator(list),
+                                       &test);
+    if (((Test *)DelinkedListGet(list, 1))->a != 300) error(&list, 1);
+    if (DelinkedListIteratorPrevious(iterator) != DelinkedListGetIterator(list))
+        error(&list, 1);
+    if (list->Size != 28) error(&list, 0);
+
+    // Erasing both ends keeps `head` and `tail` consistent.
+    if (DelinkedListErase(list, DelinkedListGetReverseIterator(list)) != NULL)
+        error(&list, 27);
+    DelinkedListErase(list, DelinkedListGetIterator(list));
+    DelinkedListErase(list, DelinkedListGetIterator(list));
+    if (((Test *)DelinkedListFront(list))->a != 0) error(&list, 0);
+    if (((Test *)DelinkedListBack(list))->a != 24) error(&list, 24);
+    while (list->Size > 0) {
+        DelinkedListErase(list, DelinkedListGetReverseIterator(list));
+    }
+    if (DelinkedListGetIterator(list) != NULL) error(&list, 0);
+    DelinkedListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "common.h"
+
+int main() {
+    DelinkedList *list = DelinkedListNew(sizeof(Test), compare);
+    DelinkedListMergeSort(list);
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {(i * 37) % 10, i, 0};
+        DelinkedListPushBack(list, &test);
+    }
+    DelinkedListMergeSort(list);
+    if (list->Size != 100) error(&list, 0);
+    DelinkedListIterator iterator = DelinkedListGetIterator(list);
+    Test *former = NULL;
+    for (unsigned int i = 0; !DelinkedListIteratorEnded(iterator); i++) {
+        Test *temp = (Test *)DelinkedListIteratorGetValue(iterator);
+        if (former != NULL && (former->a > temp->a ||
+                               (former->a == temp->a && former->b > temp->b)))
+            error(&list, i);
+        former = temp;
+        iterator = DelinkedListIteratorNext(iterator);
+    }
+    // Walk backwards to check `previous` links.
+    iterator = DelinkedListGetReverseIterator(list);
+    for (unsigned int i = 100; i > 0; i--) {
+        Test *temp = (Test *)DelinkedListIteratorGetValue(iterator);
+        if (temp != DelinkedListGet(list, i - 1)) error(&list, i - 1);
+        iterator = DelinkedListIteratorPrevious(iterator);
+    }
+    if (!DelinkedListIteratorEnded(iterator)) error(&list, 0);
+    DelinkedListDelete(&list);
+    return 0;
+}
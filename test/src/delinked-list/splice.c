@@ -0,0 +1,66 @@
+#include "common.h"
+
+int main() {
+    DelinkedList *list = DelinkedListNew(sizeof(Test), compare);
+    DelinkedList *other = DelinkedListNew(sizeof(Test), compare);
+    for (unsigned int i = 0; i < 10; i++) {
+        Test test = {i, 0, 0};
+        DelinkedListPushBack(list, &test);
+        test.a = 100 + i;
+        DelinkedListPushBack(other, &test);
+    }
+    // Move { 103, 104, 105 } before 5, keeping the moved nodes.
+    DelinkedListIterator first = DelinkedListGetIterator(other);
+    for (int i = 0; i < 3; i++) first = DelinkedListIteratorNext(first);
+    DelinkedListIterator last = first;
+    for (int i = 0; i < 3; i++) last = DelinkedListIteratorNext(last);
+    DelinkedListIterator position = DelinkedListGetIterator(list);
+    for (int i = 0; i < 5; i++) position = DelinkedListIteratorNext(position);
+    DelinkedListSplice(list, position, other, first, last);
+    unsigned int expected[] = {0, 1, 2, 3, 4, 103, 104, 105, 5, 6, 7, 8, 9};
+    if (list->Size != 13 || other->Size != 7) error(&list, 0);
+    if (DelinkedListIteratorGetValue(first) != DelinkedListGet(list, 5))
+        error(&list, 5);
+    for (unsigned int i = 0; i < 13; i++) {
+        if (((Test *)DelinkedListGet(list, i))->a != expected[i])
+            error(&list, i);
+    }
+    DelinkedListIterator iterator = DelinkedListGetReverseIterator(list);
+    for (unsigned int i = 13; i > 0; i--) {
+        if (((Test *)DelinkedListIteratorGetValue(iterator))->a !=
+            expected[i - 1])
+            error(&list, i - 1);
+        iterator = DelinkedListIteratorPrevious(iterator);
+    }
+    unsigned int rest[] = {100, 101, 102, 106, 107, 108, 109};
+    for (unsigned int i = 0; i < 7; i++) {
+        if (((Test *)DelinkedListGet(other, i))->a != rest[i])
+            error(&other, i);
+    }
+
+    // Move the first three elements of `list` to its end.
+    last = DelinkedListGetIterator(list);
+    for (int i = 0; i < 3; i++) last = DelinkedListIteratorNext(last);
+    DelinkedListSplice(list, NULL, list, DelinkedListGetIterator(list), last);
+    if (list->Size != 13) error(&list, 0);
+    for (unsigned int i = 0; i < 13; i++) {
+        if (((Test *)DelinkedListGet(list, i))->a != expected[(i + 3) % 13])
+            error(&list, i);
+    }
+
+    // Move the whole of `other` to the begin of `list`.
+    DelinkedListSplice(list, DelinkedListGetIterator(list), other,
+                       DelinkedListGetIterator(other), NULL);
+    if (list->Size != 20 || other->Size != 0) error(&list, 0);
+    if (DelinkedListGetIterator(other) != NULL ||
+        DelinkedListGetReverseIterator(other) != NULL)
+        error(&other, 0);
+    for (unsigned int i = 0; i < 7; i++) {
+        if (((Test *)DelinkedListGet(list, i))->a != rest[i]) error(&list, i);
+    }
+    if (((Test *)DelinkedListBack(list))->a != 2) error(&list, 19);
+
+    DelinkedListDelete(&list);
+    DelinkedListDelete(&other);
+    return 0;
+}
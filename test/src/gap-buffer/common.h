@@ -0,0 +1,20 @@
+#ifndef __GAP_BUFFER_TEST__
+#define __GAP_BUFFER_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gap-buffer.h"
+#include "test.h"
+
+int error(GapBuffer **const restrict buffer, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nGapBuffer:\n", i);
+    for (unsigned int i = 0; i < (*buffer)->Size; i++) {
+        Test *temp = (Test *)GapBufferGet(*buffer, i);
+        printf("[%d]: { %d, %d, %d }\n", i, temp->a, temp->b, temp->c);
+    }
+    GapBufferDelete(buffer);
+    exit(-1);
+}
+
+#endif  // __GAP_BUFFER_TEST__
@@ -0,0 +1,24 @@
+#include "common.h"
+
+int main() {
+    GapBuffer *buffer = GapBufferNew(32, sizeof(Test));
+    for (unsigned int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        GapBufferInsert(buffer, &test);
+    }
+
+    // Moving the cursor back and forth never changes the visible order.
+    const size_t cursors[] = {0, 25, 10, 3, 24, 12, 12, 0};
+    for (unsigned int j = 0; j < 8; j++) {
+        GapBufferMoveCursor(buffer, cursors[j]);
+        if (buffer->Cursor != cursors[j]) error(&buffer, j);
+        for (unsigned int i = 0; i < buffer->Size; i++) {
+            Test *temp = (Test *)GapBufferGet(buffer, i);
+            if (temp->a != i || temp->b != i + 1 || temp->c != i + 2)
+                error(&buffer, i);
+        }
+    }
+
+    GapBufferDelete(&buffer);
+    return 0;
+}
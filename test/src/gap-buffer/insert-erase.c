@@ -0,0 +1,55 @@
+#include "common.h"
+
+int main() {
+    GapBuffer *buffer = GapBufferNew(4, sizeof(Test));
+
+    // Typing at the cursor appends in order.
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {i, i + 1, i + 2};
+        GapBufferInsert(buffer, &test);
+    }
+    if (buffer->Size != 100 || buffer->Cursor != 100 ||
+        buffer->Capacity != 128)
+        error(&buffer, 0);
+
+    // Edits in the middle keep the elements on both sides.
+    GapBufferMoveCursor(buffer, 50);
+    Test values[3] = {{1000, 0, 0}, {1001, 0, 0}, {1002, 0, 0}};
+    GapBufferInsertRange(buffer, values, 3);
+    if (buffer->Cursor != 53 || ((Test *)GapBufferGet(buffer, 52))->a != 1002 ||
+        ((Test *)GapBufferGet(buffer, 53))->a != 50)
+        error(&buffer, 0);
+    GapBufferEraseBefore(buffer, 3);
+    GapBufferErase(buffer, 10);
+    if (buffer->Size != 90 || ((Test *)GapBufferGet(buffer, 49))->a != 49 ||
+        ((Test *)GapBufferGet(buffer, 50))->a != 60)
+        error(&buffer, 0);
+    GapBufferInsertRange(buffer, values, 0);
+
+    // Growing with the cursor in the middle keeps the tail after the gap.
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {2000 + i, 0, 0};
+        GapBufferInsert(buffer, &test);
+    }
+    if (buffer->Size != 190 || buffer->Capacity != 256) error(&buffer, 0);
+    for (unsigned int i = 0; i < 190; i++) {
+        const unsigned int expected =
+            i < 50 ? i : i < 150 ? 2000 + i - 50 : i - 90;
+        if (((Test *)GapBufferGet(buffer, i))->a != expected)
+            error(&buffer, i);
+    }
+
+    GapBufferEraseAt(buffer, 50, 100);
+    GapBufferInsertAt(buffer, 0, &(Test){3000, 0, 0});
+    GapBufferSet(buffer, 90, &(Test){4000, 0, 0});
+    Test output[91];
+    GapBufferCopyTo(buffer, output);
+    for (unsigned int i = 0; i < 91; i++) {
+        const unsigned int expected =
+            i == 0 ? 3000 : i == 90 ? 4000 : i < 51 ? i - 1 : i + 9;
+        if (output[i].a != expected) error(&buffer, i);
+    }
+
+    GapBufferDelete(&buffer);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "common.h"
+
+int check(LinkedList* list, const unsigned int* expected) {
+    for (unsigned int i = 0; i < list->Size; i++) {
+        if (((Test*)LinkedListGet(list, i))->a != expected[i]) return i;
+    }
+    for (unsigned int i = list->Size; i > 0; i--) {
+        if (((Test*)LinkedListGet(list, i - 1))->a != expected[i - 1])
+            return i - 1;
+    }
+    return -1;
+}
+
+int main() {
+    LinkedList* list = LinkedListNew(sizeof(Test), compare);
+    unsigned int expected[64];
+    unsigned int size = 0;
+    for (unsigned int i = 0; i < 40; i++) {
+        Test test = {i * 2, 0, 0};
+        LinkedListPushBack(list, &test);
+        expected[size++] = i * 2;
+    }
+    int i = check(list, expected);
+    if (i != -1) error(&list, i);
+
+    // Insert after a cached position, then read around it.
+    for (unsigned int j = 0; j < 10; j++) {
+        unsigned int index = 5 + j * 3;
+        LinkedListGet(list, index + 2);
+        Test test = {100 + j, 0, 0};
+        LinkedListInsert(list, index, &test);
+        for (unsigned int k = size; k > index; k--) {
+            expected[k] = expected[k - 1];
+        }
+        expected[index] = 100 + j;
+        size++;
+        i = check(list, expected);
+        if (i != -1) error(&list, i);
+    }
+
+    // Cursor at the first or the last node must not outlive it.
+    LinkedListGet(list, 0);
+    LinkedListPopFront(list);
+    size--;
+    for (unsigned int k = 0; k < size; k++) expected[k] = expected[k + 1];
+    LinkedListGet(list, 10);
+    Test test = {200, 0, 0};
+    LinkedListPushFront(list, &test);
+    for (unsigned int k = size; k > 0; k--) expected[k] = expected[k - 1];
+    expected[0] = 200;
+    size++;
+    if (((Test*)LinkedListGet(list, 11))->a != expected[11])
+        error(&list, 11);
+    LinkedListGet(list, size - 1);
+    LinkedListPopBack(list);
+    size--;
+    i = check(list, expected);
+    if (i != -1) error(&list, i);
+
+    LinkedListGet(list, 20);
+    LinkedListMergeSort(list);
+    for (unsigned int j = 1; j < size; j++) {
+        for (unsigned int k = j; k > 0 && expected[k - 1] > expected[k]; k--) {
+            unsigned int temp = expected[k];
+            expected[k] = expected[k - 1];
+            expected[k - 1] = temp;
+        }
+    }
+    i = check(list, expected);
+    if (i != -1) error(&list, i);
+
+    while (list->Size > 0) LinkedListPopBack(list);
+    for (unsigned int j = 0; j < 5; j++) {
+        Test test = {j, 0, 0};
+        LinkedListPushBack(list, &test);
+        if (((Test*)LinkedListGet(list, j))->a != j) error(&list, j);
+    }
+    LinkedListDelete(&list);
+    return 0;
+}
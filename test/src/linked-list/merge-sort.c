@@ -0,0 +1,39 @@
+#include "common.h"
+
+int main() {
+    LinkedList *list = LinkedListNew(sizeof(Test), compare);
+    LinkedListMergeSort(list);
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {(i * 37) % 10, i, 0};
+        LinkedListPushBack(list, &test);
+    }
+    LinkedListMergeSort(list);
+    if (list->Size != 100) error(&list, 0);
+    LinkedListIterator iterator = LinkedListGetIterator(list);
+    Test *former = NULL;
+    for (unsigned int i = 0; !LinkedListIteratorEnded(iterator); i++) {
+        Test *temp = (Test *)LinkedListIteratorGetValue(iterator);
+        if (former != NULL && (former->a > temp->a ||
+                               (former->a == temp->a && former->b > temp->b)))
+            error(&list, i);
+        former = temp;
+        iterator = LinkedListIteratorNext(iterator);
+    }
+    if (LinkedListBack(list) != former) error(&list, 99);
+    Test test = {100, 100, 0};
+    LinkedListPushBack(list, &test);
+    if (((Test *)LinkedListGet(list, 100))->a != 100) error(&list, 100);
+    // Sorting after PopBack must stop at the new last element.
+    LinkedListPopBack(list);
+    LinkedListPopBack(list);
+    LinkedListMergeSort(list);
+    if (list->Size != 99) error(&list, 0);
+    if (((Test *)LinkedListBack(list))->a != 9) error(&list, 98);
+    iterator = LinkedListGetIterator(list);
+    for (unsigned int i = 0; i < 99; i++) {
+        iterator = LinkedListIteratorNext(iterator);
+    }
+    if (!LinkedListIteratorEnded(iterator)) error(&list, 99);
+    LinkedListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,23 @@
+#include "common.h"
+
+int main() {
+    MinMaxHeap *heap = MinMaxHeapNew(10, sizeof(Test), compare);
+    Test tests[100];
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {(i * 37) % 100, i + 1, i + 2};
+        tests[i] = test;
+    }
+    MinMaxHeapBuild(heap, tests, 100);
+    for (unsigned int i = 0; i < 50; i++) {
+        Test *temp = (Test *)MinMaxHeapMax(heap);
+        if (temp->a != 99 - i) error(&heap, i);
+        MinMaxHeapPopMax(heap);
+    }
+    for (unsigned int i = 0; i < 50; i++) {
+        Test *temp = (Test *)MinMaxHeapMin(heap);
+        if (temp->a != i) error(&heap, i);
+        MinMaxHeapPopMin(heap);
+    }
+    MinMaxHeapDelete(&heap);
+    return 0;
+}
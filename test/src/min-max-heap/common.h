@@ -0,0 +1,20 @@
+#ifndef __MIN_MAX_HEAP_TEST__
+#define __MIN_MAX_HEAP_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "min-max-heap.h"
+#include "test.h"
+
+int error(MinMaxHeap **const restrict heap, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nMinMaxHeap:\n", i);
+    for (unsigned int j = 0; j < (*heap)->Size; j++) {
+        Test *temp = (Test *)((*heap)->array + j * (*heap)->elementSize);
+        printf("[%d]: { %d, %d, %d }\n", j, temp->a, temp->b, temp->c);
+    }
+    MinMaxHeapDelete(heap);
+    exit(-1);
+}
+
+#endif  // __MIN_MAX_HEAP_TEST__
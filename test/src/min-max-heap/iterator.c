@@ -0,0 +1,23 @@
+#include "common.h"
+
+int main() {
+    MinMaxHeap *heap = MinMaxHeapNew(10, sizeof(Test), compare);
+    for (int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        MinMaxHeapPush(heap, &test);
+    }
+    MinMaxHeapIterator iterator = MinMaxHeapGetIterator(heap);
+    for (unsigned int i = 0; i < heap->Size; i++) {
+        Test *temp = (Test *)MinMaxHeapIteratorGetValue(iterator);
+        if (temp->a > 24 || temp->b > 25 || temp->c > 26) error(&heap, i);
+        iterator = MinMaxHeapIteratorNext(iterator);
+    }
+    iterator = MinMaxHeapGetReverseIterator(heap);
+    for (unsigned int i = 0; i < heap->Size; i++) {
+        Test *temp = (Test *)MinMaxHeapIteratorGetValue(iterator);
+        if (temp->a > 24 || temp->b > 25 || temp->c > 26) error(&heap, i);
+        iterator = MinMaxHeapIteratorPrevious(iterator);
+    }
+    MinMaxHeapDelete(&heap);
+    return 0;
+}
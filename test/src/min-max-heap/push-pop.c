@@ -0,0 +1,23 @@
+#include "common.h"
+
+int main() {
+    MinMaxHeap *heap = MinMaxHeapNew(10, sizeof(Test), compare);
+    for (int i = 0; i < 25; i++) {
+        Test test = {(i * 7) % 25, i + 1, i + 2};
+        MinMaxHeapPush(heap, &test);
+    }
+    for (unsigned int i = 0; i < 12; i++) {
+        Test *temp = (Test *)MinMaxHeapMin(heap);
+        if (temp->a != i) error(&heap, i);
+        MinMaxHeapPopMin(heap);
+        temp = (Test *)MinMaxHeapMax(heap);
+        if (temp->a != 24 - i) error(&heap, i);
+        MinMaxHeapPopMax(heap);
+    }
+    Test *temp = (Test *)MinMaxHeapMin(heap);
+    if (heap->Size != 1 || temp->a != 12) error(&heap, 12);
+    temp = (Test *)MinMaxHeapMax(heap);
+    if (temp->a != 12) error(&heap, 12);
+    MinMaxHeapDelete(&heap);
+    return 0;
+}
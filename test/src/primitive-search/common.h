@@ -0,0 +1,59 @@
+#ifndef __PRIMITIVE_SEARCH_TEST__
+#define __PRIMITIVE_SEARCH_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "primitive-search.h"
+
+int error(const PrimitiveType type, const unsigned int size,
+          const unsigned int i) {
+    printf("Result Incorrect At [%d]\nType: %d, Size: %d\n", i, type, size);
+    exit(-1);
+}
+
+/**
+ * Fill `array` with `size` elements of `type`. Element `i` holds `i % 97`.
+ */
+void fill(void *const array, const unsigned int size,
+          const PrimitiveType type) {
+    for (unsigned int i = 0; i < size; i++) {
+        switch (type) {
+            case PRIMITIVE_INT32:
+                ((int *)array)[i] = i % 97;
+                break;
+            case PRIMITIVE_INT64:
+                ((long long *)array)[i] = i % 97;
+                break;
+            case PRIMITIVE_FLOAT:
+                ((float *)array)[i] = i % 97;
+                break;
+            case PRIMITIVE_DOUBLE:
+                ((double *)array)[i] = i % 97;
+                break;
+        }
+    }
+}
+
+/**
+ * Store `value` converted to `type` into `result`.
+ */
+void *convert(void *const result, const int value, const PrimitiveType type) {
+    switch (type) {
+        case PRIMITIVE_INT32:
+            *(int *)result = value;
+            break;
+        case PRIMITIVE_INT64:
+            *(long long *)result = value;
+            break;
+        case PRIMITIVE_FLOAT:
+            *(float *)result = value;
+            break;
+        case PRIMITIVE_DOUBLE:
+            *(double *)result = value;
+            break;
+    }
+    return result;
+}
+
+#endif  // __PRIMITIVE_SEARCH_TEST__
@@ -0,0 +1,24 @@
+#include "common.h"
+
+int main() {
+    double array[1000], low, high;
+    for (PrimitiveType type = PRIMITIVE_INT32; type <= PRIMITIVE_DOUBLE;
+         type++) {
+        fill(array, 1000, type);
+        convert((char *)array + 500 * PrimitiveSize(type), -5, type);
+        convert(&low, -10, type);
+        convert(&high, -1, type);
+        if (PrimitiveFindInRange(array, 1000, type, &low, &high) != 500)
+            error(type, 1000, 500);
+        convert(&low, 50, type);
+        convert(&high, 60, type);
+        if (PrimitiveFindInRange(array, 1000, type, &low, &high) != 50)
+            error(type, 1000, 50);
+        convert(&low, 200, type);
+        convert(&high, 300, type);
+        if (PrimitiveFindInRange(array, 1000, type, &low, &high) !=
+            (size_t)-1)
+            error(type, 1000, 0);
+    }
+    return 0;
+}
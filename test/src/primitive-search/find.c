@@ -0,0 +1,29 @@
+#include "common.h"
+
+int main() {
+    const unsigned int sizes[] = {0, 1, 96, 97, 300, 1000};
+    double array[1000], value;
+    for (PrimitiveType type = PRIMITIVE_INT32; type <= PRIMITIVE_DOUBLE;
+         type++) {
+        for (unsigned int s = 0; s < 6; s++) {
+            const unsigned int size = sizes[s];
+            fill(array, size, type);
+            for (int key = -1; key < 98; key++) {
+                convert(&value, key, type);
+                size_t index =
+                    key >= 0 && key < 97 && (unsigned int)key < size
+                        ? (size_t)key
+                        : (size_t)-1;
+                if (PrimitiveFind(array, size, type, &value) != index)
+                    error(type, size, key);
+                unsigned int count =
+                    key >= 0 && key < 97 && (unsigned int)key < size
+                        ? (size - key + 96) / 97
+                        : 0;
+                if (PrimitiveCount(array, size, type, &value) != count)
+                    error(type, size, key);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include <math.h>
+
+#include "common.h"
+
+int main() {
+    double array[1000];
+    for (PrimitiveType type = PRIMITIVE_INT32; type <= PRIMITIVE_DOUBLE;
+         type++) {
+        if (PrimitiveMin(array, 0, type) != (size_t)-1) error(type, 0, 0);
+        fill(array, 1000, type);
+        if (PrimitiveMin(array, 1000, type) != 0) error(type, 1000, 0);
+        if (PrimitiveMax(array, 1000, type) != 96) error(type, 1000, 96);
+        fill(array, 20, type);
+        if (PrimitiveMax(array, 20, type) != 19) error(type, 20, 19);
+    }
+
+    // NaN is skipped.
+    float floats[3] = {NAN, 2, 1};
+    if (PrimitiveMin(floats, 3, PRIMITIVE_FLOAT) != 2)
+        error(PRIMITIVE_FLOAT, 3, 2);
+    if (PrimitiveMax(floats, 3, PRIMITIVE_FLOAT) != 1)
+        error(PRIMITIVE_FLOAT, 3, 1);
+    if (PrimitiveMin(floats, 1, PRIMITIVE_FLOAT) != (size_t)-1)
+        error(PRIMITIVE_FLOAT, 1, 0);
+    return 0;
+}
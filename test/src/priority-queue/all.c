@@ -6,10 +6,11 @@ static Bool test(const void *value) {
 }
 
 int main() {
-    PriorityQueue *queue = PriorityQueueNew(10, sizeof(Test));
+    PriorityQueue *queue =
+        PriorityQueueNew(10, sizeof(Test), PRIORITY_QUEUE_INT64, FALSE);
     for (int i = 0; i < 25; i++) {
         Test test = {i, i + 1, i + 2};
-        PriorityQueuePush(queue, i, &test);
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = i}, &test);
     }
     if (PriorityQueueAll(queue, test) != FALSE) error(&queue, 0);
     PriorityQueueDelete(&queue);
@@ -11,8 +11,7 @@ int error(PriorityQueue **const restrict queue, const unsigned int i) {
     printf("Element Incorrect At [%d]\nPriorityQueue:\n", i);
     for (unsigned int j = 0; j < (*queue)->Size; j++) {
         PriorityQueueNode *node =
-            (PriorityQueueNode *)((*queue)->heap->array +
-                                  j * sizeof(PriorityQueueNode));
+            (PriorityQueueNode *)((*queue)->array + j * (*queue)->nodeSize);
         Test *temp = (Test *)node->value;
         printf("[%d]: { %d, %d, %d }\n", j, temp->a, temp->b, temp->c);
     }
@@ -1,10 +1,11 @@
 #include "common.h"
 
 int main() {
-    PriorityQueue *queue = PriorityQueueNew(10, sizeof(Test));
+    PriorityQueue *queue =
+        PriorityQueueNew(10, sizeof(Test), PRIORITY_QUEUE_INT64, FALSE);
     for (int i = 0; i < 25; i++) {
         Test test = {i, i + 1, i + 2};
-        PriorityQueuePush(queue, i, &test);
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = i}, &test);
     }
     PriorityQueueIterator iterator = PriorityQueueGetIterator(queue);
     for (unsigned int i = 0; i < queue->Size; i++) {
@@ -0,0 +1,54 @@
+#include <limits.h>
+
+#include "common.h"
+
+int main() {
+    PriorityQueue *queue =
+        PriorityQueueNew(2, sizeof(Test), PRIORITY_QUEUE_INT64, FALSE);
+    long long int64[] = {0, LLONG_MIN, LLONG_MAX, -1, 1};
+    unsigned int int64Order[] = {2, 4, 0, 3, 1};
+    for (unsigned int i = 0; i < 5; i++) {
+        Test test = {i, i + 1, i + 2};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = int64[i]},
+                          &test);
+    }
+    for (unsigned int i = 0; i < 5; i++) {
+        Test *temp = (Test *)PriorityQueueFront(queue);
+        if (temp->a != int64Order[i] ||
+            PriorityQueueFrontPriority(queue).Int64 != int64[int64Order[i]])
+            error(&queue, i);
+        PriorityQueuePop(queue);
+    }
+    PriorityQueueDelete(&queue);
+
+    queue = PriorityQueueNew(2, sizeof(Test), PRIORITY_QUEUE_UINT64, FALSE);
+    unsigned long long uint64[] = {1, ULLONG_MAX, 0, ULLONG_MAX - 1};
+    unsigned int uint64Order[] = {1, 3, 0, 2};
+    for (unsigned int i = 0; i < 4; i++) {
+        Test test = {i, i + 1, i + 2};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.UInt64 = uint64[i]},
+                          &test);
+    }
+    for (unsigned int i = 0; i < 4; i++) {
+        Test *temp = (Test *)PriorityQueueFront(queue);
+        if (temp->a != uint64Order[i]) error(&queue, i);
+        PriorityQueuePop(queue);
+    }
+    PriorityQueueDelete(&queue);
+
+    queue = PriorityQueueNew(2, sizeof(Test), PRIORITY_QUEUE_DOUBLE, FALSE);
+    double float64[] = {0.5, -1e300, 1e300, -0.25};
+    unsigned int float64Order[] = {2, 0, 3, 1};
+    for (unsigned int i = 0; i < 4; i++) {
+        Test test = {i, i + 1, i + 2};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Double = float64[i]},
+                          &test);
+    }
+    for (unsigned int i = 0; i < 4; i++) {
+        Test *temp = (Test *)PriorityQueueFront(queue);
+        if (temp->a != float64Order[i]) error(&queue, i);
+        PriorityQueuePop(queue);
+    }
+    PriorityQueueDelete(&queue);
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include "common.h"
+
+int main() {
+    PriorityQueue *queue =
+        PriorityQueueNew(10, sizeof(Test), PRIORITY_QUEUE_INT64, TRUE);
+    Test output;
+    for (int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = i}, &test);
+    }
+    // an element with higher priority is returned immediately
+    Test higher = {100, 0, 0};
+    PriorityQueuePushPop(queue, (PriorityQueuePriority){.Int64 = 100}, &higher,
+                         &output);
+    if (output.a != 100 || queue->Size != 25) error(&queue, 0);
+    // an element with equal priority is queued after existing ones
+    Test equal = {200, 0, 0};
+    PriorityQueuePushPop(queue, (PriorityQueuePriority){.Int64 = 24}, &equal,
+                         &output);
+    if (output.a != 24 || queue->Size != 25) error(&queue, 1);
+    Test replaced = {300, 0, 0};
+    PriorityQueueReplaceTop(queue, (PriorityQueuePriority){.Int64 = -1},
+                            &replaced);
+    unsigned int expected[] = {23, 22, 21};
+    for (unsigned int i = 0; i < 3; i++) {
+        PriorityQueuePopInto(queue, &output);
+        if (output.a != expected[i]) error(&queue, i + 2);
+    }
+    PriorityQueueDelete(&queue);
+    return 0;
+}
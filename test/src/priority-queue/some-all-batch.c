@@ -0,0 +1,35 @@
+#include "common.h"
+
+static unsigned int limit = 0;
+
+static unsigned long long below(const void *values, unsigned int count) {
+    const Test *tests = (const Test *)values;
+    unsigned long long mask = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        mask |= (unsigned long long)(tests[i].a < limit) << i;
+    }
+    return mask;
+}
+
+int main() {
+    PriorityQueue *queue =
+        PriorityQueueNew(10, sizeof(Test), PRIORITY_QUEUE_INT64, FALSE);
+    if (PriorityQueueSomeBatch(queue, below) ||
+        !PriorityQueueAllBatch(queue, below))
+        error(&queue, 0);
+    for (unsigned int i = 0; i < 150; i++) {
+        Test test = {i, i + 1, i + 2};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = i},
+                          &test);
+    }
+    limit = 0;
+    if (PriorityQueueSomeBatch(queue, below)) error(&queue, 0);
+    limit = 150;
+    if (!PriorityQueueAllBatch(queue, below)) error(&queue, 0);
+    limit = 149;
+    if (!PriorityQueueSomeBatch(queue, below) ||
+        PriorityQueueAllBatch(queue, below))
+        error(&queue, 149);
+    PriorityQueueDelete(&queue);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#include "common.h"
+
+int main() {
+    PriorityQueue *queue =
+        PriorityQueueNew(10, sizeof(Test), PRIORITY_QUEUE_INT64, TRUE);
+    for (int i = 0; i < 25; i++) {
+        Test test = {i, i % 5, i / 5};
+        PriorityQueuePush(queue, (PriorityQueuePriority){.Int64 = i % 5},
+                          &test);
+    }
+    for (unsigned int i = 0; i < 25; i++) {
+        Test *temp = (Test *)PriorityQueueFront(queue);
+        if (temp->b != 4 - i / 5 || temp->c != i % 5) error(&queue, i);
+        PriorityQueuePop(queue);
+    }
+    PriorityQueueDelete(&queue);
+    return 0;
+}
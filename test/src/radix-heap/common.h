@@ -0,0 +1,26 @@
+#ifndef __RADIX_HEAP_TEST__
+#define __RADIX_HEAP_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "radix-heap.h"
+#include "test.h"
+
+int error(RadixHeap **const restrict heap, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nRadixHeap:\n", i);
+    for (unsigned int j = 0; j < 65; j++) {
+        ArrayStack *bucket = &(*heap)->buckets[j];
+        for (unsigned int k = 0; k < bucket->Size; k++) {
+            RadixHeapNode *node =
+                (RadixHeapNode *)(bucket->array + k * bucket->elementSize);
+            Test *temp = (Test *)node->value;
+            printf("[%d][%d]: %llu { %d, %d, %d }\n", j, k, node->key, temp->a,
+                   temp->b, temp->c);
+        }
+    }
+    RadixHeapDelete(heap);
+    exit(-1);
+}
+
+#endif  // __RADIX_HEAP_TEST__
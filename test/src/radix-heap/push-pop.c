@@ -0,0 +1,26 @@
+#include "common.h"
+
+int main() {
+    RadixHeap *heap = RadixHeapNew(sizeof(Test));
+    for (int i = 0; i < 25; i++) {
+        Test test = {(i * 7) % 25, i + 1, i + 2};
+        RadixHeapPush(heap, test.a * 1000ull, &test);
+    }
+    for (unsigned int i = 0; i < 25; i++) {
+        Test *temp = (Test *)RadixHeapFront(heap);
+        if (temp->a != i || RadixHeapFrontKey(heap) != i * 1000ull)
+            error(&heap, i);
+        RadixHeapPop(heap);
+        if (i % 2 == 0) {
+            // keys pushed after popping must not be smaller
+            Test test = {i * 1000 + 500, 0, 0};
+            RadixHeapPush(heap, i * 1000ull + 500, &test);
+            temp = (Test *)RadixHeapFront(heap);
+            if (temp->a != i * 1000 + 500) error(&heap, i);
+            RadixHeapPop(heap);
+        }
+    }
+    if (heap->Size != 0) error(&heap, 25);
+    RadixHeapDelete(&heap);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef __SEGMENTED_LIST_TEST__
+#define __SEGMENTED_LIST_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "segmented-list.h"
+#include "test.h"
+
+int error(SegmentedList **const restrict list, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nSegmentedList:\n", i);
+    for (unsigned int i = 0; i < (*list)->Size; i++) {
+        Test *temp = (Test *)SegmentedListGet(*list, i);
+        printf("[%d]: { %d, %d, %d }\n", i, temp->a, temp->b, temp->c);
+    }
+    SegmentedListDelete(list);
+    exit(-1);
+}
+
+#endif  // __SEGMENTED_LIST_TEST__
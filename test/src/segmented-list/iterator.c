@@ -0,0 +1,27 @@
+#include "common.h"
+
+int main() {
+    SegmentedList *list = SegmentedListNew(1, sizeof(Test), compare);
+    for (int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        SegmentedListPushBack(list, &test);
+    }
+    SegmentedListIterator iterator = SegmentedListGetIterator(list);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)SegmentedListIteratorGetValue(iterator);
+        if (temp->a != i || temp->b != i + 1 || temp->c != i + 2)
+            error(&list, i);
+        iterator = SegmentedListIteratorNext(iterator);
+    }
+    if (!SegmentedListIteratorEnded(iterator)) error(&list, 0);
+    iterator = SegmentedListGetReverseIterator(list);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)SegmentedListIteratorGetValue(iterator);
+        if (temp->a != 24 - i || temp->b != 25 - i || temp->c != 26 - i)
+            error(&list, i);
+        iterator = SegmentedListIteratorPrevious(iterator);
+    }
+    if (!SegmentedListIteratorEnded(iterator)) error(&list, 0);
+    SegmentedListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include "common.h"
+
+int main() {
+    SegmentedList *list = SegmentedListNew(3, sizeof(Test), compare);
+    if (list->Capacity != 4) error(&list, 0);
+
+    // Pointers stay valid while blocks are added.
+    Test *first = NULL, *middle = NULL;
+    for (unsigned int i = 0; i < 1000; i++) {
+        Test test = {i, i + 1, i + 2};
+        SegmentedListPushBack(list, &test);
+        if (i == 0) first = SegmentedListBack(list);
+        if (i == 100) middle = SegmentedListBack(list);
+    }
+    if (list->Capacity != 1020 || first != SegmentedListFront(list) ||
+        middle != SegmentedListGet(list, 100) || middle->a != 100)
+        error(&list, 0);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)SegmentedListGet(list, i);
+        if (temp->a != i || temp->b != i + 1 || temp->c != i + 2)
+            error(&list, i);
+    }
+
+    SegmentedListSet(list, 999, &(Test){7, 8, 9});
+    if (SegmentedListFind(list, &(Test){7, 8, 9}) != 7 ||
+        SegmentedListFind(list, &(Test){1000, 0, 0}) != (size_t)-1)
+        error(&list, 0);
+
+    // Popping keeps blocks until they are released explicitly.
+    while (list->Size > 10) SegmentedListPopBack(list);
+    if (list->Capacity != 1020) error(&list, 0);
+    SegmentedListShrinkToFit(list);
+    if (list->Capacity != 12 || ((Test *)SegmentedListBack(list))->a != 9)
+        error(&list, 0);
+    SegmentedListReserve(list, 100);
+    if (list->Capacity != 124) error(&list, 0);
+    while (list->Size > 0) SegmentedListPopBack(list);
+    if (SegmentedListBack(list) != NULL) error(&list, 0);
+
+    SegmentedListDelete(&list);
+    return 0;
+}
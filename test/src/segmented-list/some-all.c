@@ -0,0 +1,28 @@
+#include "common.h"
+
+static Bool some(const void *value) {
+    Test *temp = (Test *)value;
+    return temp->a == 20;
+}
+
+static Bool all(const void *value) {
+    Test *temp = (Test *)value;
+    return temp->b == temp->a + 1;
+}
+
+int main() {
+    SegmentedList *list = SegmentedListNew(2, sizeof(Test), compare);
+    if (SegmentedListSome(list, some) != FALSE) error(&list, 0);
+    for (int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        SegmentedListPushBack(list, &test);
+    }
+    if (SegmentedListSome(list, some) != TRUE) error(&list, 0);
+    if (SegmentedListAll(list, all) != TRUE) error(&list, 0);
+    SegmentedListSet(list, 24, &(Test){24, 0, 0});
+    if (SegmentedListAll(list, all) != FALSE) error(&list, 0);
+    SegmentedListPopBack(list);
+    if (SegmentedListAll(list, all) != TRUE) error(&list, 0);
+    SegmentedListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,21 @@
+#include "common.h"
+
+int main() {
+    TimerWheel *wheel = TimerWheelNew(100, sizeof(Test));
+    unsigned long long times[] = {70000, 101, 356, 300, 65636, 1000000, 612};
+    unsigned int order[] = {1, 3, 2, 6, 4, 0, 5};
+    for (unsigned int i = 0; i < 7; i++) {
+        Test test = {i, times[i], times[i] >> 32};
+        TimerWheelSchedule(wheel, times[i], &test);
+    }
+    for (unsigned long long time = 200; time <= 1000000; time += 200) {
+        TimerWheelAdvance(wheel, time, expire);
+        for (unsigned int i = 0; i < expiredSize; i++) {
+            if (expired[i].a != order[i] || expired[i].b > time)
+                error(&wheel, i);
+        }
+    }
+    if (expiredSize != 7 || wheel->Size != 0) error(&wheel, expiredSize);
+    TimerWheelDelete(&wheel);
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include "common.h"
+
+int main() {
+    TimerWheel *wheel = TimerWheelNew(0, sizeof(Test));
+    TimerWheelHandle handles[25];
+    for (unsigned int i = 0; i < 25; i++) {
+        Test test = {i, i + 1, i + 2};
+        handles[i] = TimerWheelSchedule(wheel, 1000 * (i % 5) + i, &test);
+    }
+    for (unsigned int i = 0; i < 25; i += 2) {
+        TimerWheelCancel(wheel, handles[i]);
+    }
+    if (wheel->Size != 12) error(&wheel, 0);
+    TimerWheelAdvance(wheel, 100000, expire);
+    if (expiredSize != 12 || wheel->Size != 0) error(&wheel, expiredSize);
+    for (unsigned int i = 0; i < expiredSize; i++) {
+        if (expired[i].a % 2 != 1) error(&wheel, i);
+        if (i > 0 && 1000 * (expired[i].a % 5) + expired[i].a <
+                         1000 * (expired[i - 1].a % 5) + expired[i - 1].a)
+            error(&wheel, i);
+    }
+    TimerWheelDelete(&wheel);
+    return 0;
+}
@@ -0,0 +1,26 @@
+#ifndef __TIMER_WHEEL_TEST__
+#define __TIMER_WHEEL_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test.h"
+#include "timer-wheel.h"
+
+Test expired[64];
+unsigned int expiredSize = 0;
+
+void expire(void *value) { expired[expiredSize++] = *(Test *)value; }
+
+int error(TimerWheel **const restrict wheel, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nTimerWheel (%llu):\n", i,
+           (*wheel)->Current);
+    for (unsigned int j = 0; j < expiredSize; j++) {
+        printf("[%d]: { %d, %d, %d }\n", j, expired[j].a, expired[j].b,
+               expired[j].c);
+    }
+    TimerWheelDelete(wheel);
+    exit(-1);
+}
+
+#endif  // __TIMER_WHEEL_TEST__
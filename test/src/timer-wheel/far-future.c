@@ -0,0 +1,26 @@
+#include "common.h"
+
+int main() {
+    TimerWheel *wheel = TimerWheelNew(5, sizeof(Test));
+    unsigned long long times[] = {(1ULL << 40) + 5, 7, 1ULL << 56,
+                                  ~0ULL - 1, (1ULL << 40) + 300};
+    for (unsigned int i = 0; i < 5; i++) {
+        Test test = {i, times[i], times[i] >> 32};
+        TimerWheelSchedule(wheel, times[i], &test);
+    }
+
+    // Empty slots are skipped, so far-future timers are reached at once.
+    unsigned int order[] = {1, 0, 4, 2, 3};
+    TimerWheelAdvance(wheel, 1ULL << 40, expire);
+    if (expiredSize != 1 || wheel->Current != 1ULL << 40)
+        error(&wheel, expiredSize);
+    TimerWheelAdvance(wheel, (1ULL << 40) + 5, expire);
+    if (expiredSize != 2) error(&wheel, expiredSize);
+    TimerWheelAdvance(wheel, ~0ULL, expire);
+    if (expiredSize != 5 || wheel->Size != 0) error(&wheel, expiredSize);
+    for (unsigned int i = 0; i < expiredSize; i++) {
+        if (expired[i].a != order[i]) error(&wheel, i);
+    }
+    TimerWheelDelete(&wheel);
+    return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef __TOP_K_HEAP_TEST__
+#define __TOP_K_HEAP_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "top-k-heap.h"
+#include "test.h"
+
+int error(TopKHeap **const restrict heap, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nTopKHeap:\n", i);
+    for (unsigned int j = 0; j < (*heap)->Size; j++) {
+        Test *temp = (Test *)((*heap)->array + j * (*heap)->elementSize);
+        printf("[%d]: { %d, %d, %d }\n", j, temp->a, temp->b, temp->c);
+    }
+    TopKHeapDelete(heap);
+    exit(-1);
+}
+
+#endif  // __TOP_K_HEAP_TEST__
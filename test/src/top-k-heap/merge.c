@@ -0,0 +1,19 @@
+#include "common.h"
+
+int main() {
+    TopKHeap *heap = TopKHeapNew(5, sizeof(Test), compare);
+    TopKHeap *other = TopKHeapNew(5, sizeof(Test), compare);
+    Test output[5];
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {i, i + 1, i + 2};
+        TopKHeapPush(i % 3 == 0 ? heap : other, &test);
+    }
+    TopKHeapMerge(heap, other);
+    TopKHeapDrain(heap, output);
+    for (unsigned int i = 0; i < 5; i++) {
+        if (output[i].a != 99 - i || output[i].b != 100 - i) error(&heap, i);
+    }
+    TopKHeapDelete(&other);
+    TopKHeapDelete(&heap);
+    return 0;
+}
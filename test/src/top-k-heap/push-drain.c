@@ -0,0 +1,21 @@
+#include "common.h"
+
+int main() {
+    TopKHeap *heap = TopKHeapNew(10, sizeof(Test), compare);
+    Test output[10];
+    for (unsigned int i = 0; i < 1000; i++) {
+        Test test = {(i * 37) % 1000, i + 1, i + 2};
+        Bool larger = heap->Size < heap->Capacity ||
+                      test.a > ((Test *)TopKHeapThreshold(heap))->a;
+        if (TopKHeapPush(heap, &test) != larger) error(&heap, i);
+    }
+    if (heap->Size != 10 || ((Test *)TopKHeapThreshold(heap))->a != 990)
+        error(&heap, 0);
+    TopKHeapDrain(heap, output);
+    if (heap->Size != 0) error(&heap, 0);
+    for (unsigned int i = 0; i < 10; i++) {
+        if (output[i].a != 999 - i) error(&heap, i);
+    }
+    TopKHeapDelete(&heap);
+    return 0;
+}
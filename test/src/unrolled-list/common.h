@@ -0,0 +1,20 @@
+#ifndef __UNROLLED_LIST_TEST__
+#define __UNROLLED_LIST_TEST__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "unrolled-list.h"
+#include "test.h"
+
+int error(UnrolledList **const restrict list, const unsigned int i) {
+    printf("Element Incorrect At [%d]\nUnrolledList:\n", i);
+    for (unsigned int i = 0; i < (*list)->Size; i++) {
+        Test *temp = (Test *)UnrolledListGet(*list, i);
+        printf("[%d]: { %d, %d, %d }\n", i, temp->a, temp->b, temp->c);
+    }
+    UnrolledListDelete(list);
+    exit(-1);
+}
+
+#endif  // __UNROLLED_LIST_TEST__
@@ -0,0 +1,50 @@
+#include "common.h"
+
+int main() {
+    UnrolledList *list = UnrolledListNew(sizeof(Test), compare);
+    unsigned int expected[2000], size = 0;
+
+    // Inserts split full nodes and erases merge sparse ones, in any order.
+    for (unsigned int i = 0; i < 2000; i++) {
+        const unsigned int index = (i * 7919) % (size + 1);
+        Test test = {i, 0, 0};
+        UnrolledListInsert(list, index, &test);
+        for (unsigned int j = size; j > index; j--) {
+            expected[j] = expected[j - 1];
+        }
+        expected[index] = i;
+        size++;
+    }
+    for (unsigned int i = 0; i < size; i++) {
+        if (((Test *)UnrolledListGet(list, i))->a != expected[i])
+            error(&list, i);
+    }
+    for (unsigned int i = 0; i < 1900; i++) {
+        const unsigned int index = (i * 104729) % size;
+        UnrolledListErase(list, index);
+        for (unsigned int j = index; j + 1 < size; j++) {
+            expected[j] = expected[j + 1];
+        }
+        size--;
+    }
+    if (list->Size != size) error(&list, 0);
+    unsigned int nodes = 0;
+    for (UnrolledListNode *node = list->head; node != NULL;
+         node = node->next) {
+        nodes++;
+    }
+    if (nodes * list->nodeCapacity > size * 4) error(&list, 0);
+    for (unsigned int i = 0; i < size; i++) {
+        if (((Test *)UnrolledListGet(list, i))->a != expected[i])
+            error(&list, i);
+    }
+
+    UnrolledListSet(list, 50, &(Test){5000, 0, 0});
+    if (UnrolledListFind(list, &(Test){5000, 0, 0}) != 50 ||
+        UnrolledListFind(list, &(Test){expected[99], 0, 0}) != 99 ||
+        UnrolledListFind(list, &(Test){6000, 0, 0}) != (size_t)-1)
+        error(&list, 0);
+
+    UnrolledListDelete(&list);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include "common.h"
+
+int main() {
+    UnrolledList *list = UnrolledListNew(sizeof(Test), compare);
+    for (int i = 0; i < 250; i++) {
+        Test test = {i, i + 1, i + 2};
+        UnrolledListPushBack(list, &test);
+    }
+    UnrolledListIterator iterator = UnrolledListGetIterator(list);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)UnrolledListIteratorGetValue(iterator);
+        if (temp->a != i || temp->b != i + 1 || temp->c != i + 2)
+            error(&list, i);
+        iterator = UnrolledListIteratorNext(iterator);
+    }
+    if (!UnrolledListIteratorEnded(iterator)) error(&list, 0);
+    iterator = UnrolledListGetReverseIterator(list);
+    for (unsigned int i = 0; i < list->Size; i++) {
+        Test *temp = (Test *)UnrolledListIteratorGetValue(iterator);
+        if (temp->a != 249 - i || temp->b != 250 - i || temp->c != 251 - i)
+            error(&list, i);
+        iterator = UnrolledListIteratorPrevious(iterator);
+    }
+    if (!UnrolledListIteratorEnded(iterator)) error(&list, 0);
+    UnrolledListDelete(&list);
+    return 0;
+}
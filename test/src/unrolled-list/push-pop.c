@@ -0,0 +1,30 @@
+#include "common.h"
+
+int main() {
+    UnrolledList *list = UnrolledListNew(sizeof(Test), compare);
+    for (unsigned int i = 0; i < 100; i++) {
+        Test test = {i, i + 1, i + 2};
+        UnrolledListPushBack(list, &test);
+        test.a = 1000 + i;
+        UnrolledListPushFront(list, &test);
+    }
+    if (list->Size != 200 || ((Test *)UnrolledListFront(list))->a != 1099 ||
+        ((Test *)UnrolledListBack(list))->a != 99)
+        error(&list, 0);
+    for (unsigned int i = 0; i < 200; i++) {
+        const unsigned int expected = i < 100 ? 1099 - i : i - 100;
+        if (((Test *)UnrolledListGet(list, i))->a != expected)
+            error(&list, i);
+    }
+    for (unsigned int i = 0; i < 100; i++) {
+        if (((Test *)UnrolledListFront(list))->a != 1099 - i) error(&list, i);
+        UnrolledListPopFront(list);
+        if (((Test *)UnrolledListBack(list))->a != 99 - i) error(&list, i);
+        UnrolledListPopBack(list);
+    }
+    if (list->Size != 0 || list->head != NULL || list->tail != NULL ||
+        UnrolledListFront(list) != NULL)
+        error(&list, 0);
+    UnrolledListDelete(&list);
+    return 0;
+}